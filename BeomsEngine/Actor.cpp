@@ -6,6 +6,13 @@
 
 IMPLEMENT_CLASS(AActor, UObject)
 
+BEGIN_PROPERTIES(AActor)
+    UPROPERTY_REGISTER(bHidden, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bCanEverTick, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bActorEnableCollision, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bBlockInput, EPropertyFlags::Edit)
+END_PROPERTIES()
+
 AActor::AActor()
     : UObject()
     , bHidden(false)
@@ -27,6 +34,21 @@ AActor::AActor()
 }
 
 AActor::~AActor()
+{
+    // GC를 거치지 않고 직접 삭제되는 경우에도 같은 정리를 수행 (GC 경로에서는 이미 비어 있음)
+    AActor::BeginDestroy();
+}
+
+void AActor::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Super::AddReferencedObjects(Collector);
+
+    Collector.AddReferencedObjects(Components);
+    Collector.AddReferencedObject(RootComponent);
+    Collector.AddReferencedObjects(OwnedActors);
+}
+
+void AActor::BeginDestroy()
 {
     // 컴포넌트들 정리
     for (UActorComponent* Component : Components)
@@ -47,6 +69,9 @@ AActor::~AActor()
         }
     }
     OwnedActors.clear();
+    RootComponent = nullptr;
+
+    Super::BeginDestroy();
 }
 
 void AActor::BeginPlay()
@@ -154,23 +179,8 @@ FMatrix AActor::GetActorTransform() const
     if (!RootComponent)
         return FMatrix::Identity;
         
-    // RootComponent의 Transform으로부터 행렬 생성
-    FVector Location = RootComponent->GetComponentLocation();
-    FVector Rotation = RootComponent->GetComponentRotation();
-    FVector Scale = RootComponent->GetComponentScale();
-    
-    // Translation -> Rotation -> Scale 순서로 변환 행렬 생성 (T * R * S)
-    FMatrix TranslationMatrix = FMatrix::CreateTranslation(Location);
-    
-    // 회전을 라디안으로 변환 (Rotation은 degree)
-    float PitchRad = FMath::DegreesToRadians(Rotation.X);
-    float YawRad = FMath::DegreesToRadians(Rotation.Y);
-    float RollRad = FMath::DegreesToRadians(Rotation.Z);
-    
-    FMatrix RotationMatrix = FMatrix::CreateRotationFromEuler(RollRad, PitchRad, YawRad);
-    FMatrix ScaleMatrix = FMatrix::CreateScale(Scale);
-    
-    return TranslationMatrix * RotationMatrix * ScaleMatrix;
+    // RootComponent의 Transform으로부터 행렬 생성 (T * R * S)
+    return RootComponent->GetComponentTransform().ToMatrixWithScale();
 }
 
 void AActor::SetActorTransform(const FMatrix& NewTransform)
@@ -179,70 +189,7 @@ void AActor::SetActorTransform(const FMatrix& NewTransform)
         return;
 
     // 행렬 분해: Transform Matrix = Translation * Rotation * Scale (T * R * S)
-
-    // 1. Translation 추출 (4번째 열)
-    FVector Translation(NewTransform[0][3], NewTransform[1][3], NewTransform[2][3]);
-    
-    // 2. R*S 부분에서 Scale 추출 (3x3 좌상단 부분)
-    FVector ScaleX(NewTransform[0][0], NewTransform[1][0], NewTransform[2][0]);
-    FVector ScaleY(NewTransform[0][1], NewTransform[1][1], NewTransform[2][1]);
-    FVector ScaleZ(NewTransform[0][2], NewTransform[1][2], NewTransform[2][2]);
-    
-    float ScaleXLength = ScaleX.Magnitude();
-    float ScaleYLength = ScaleY.Magnitude();
-    float ScaleZLength = ScaleZ.Magnitude();
-    
-    FVector Scale(ScaleXLength, ScaleYLength, ScaleZLength);
-    
-    // 3. R*S에서 Scale을 제거하여 Rotation 추출
-    FMatrix RotationMatrix;
-    RotationMatrix[0][0] = ScaleXLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[0][0] / ScaleXLength : 1.0f;
-    RotationMatrix[1][0] = ScaleXLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[1][0] / ScaleXLength : 0.0f;
-    RotationMatrix[2][0] = ScaleXLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[2][0] / ScaleXLength : 0.0f;
-    
-    RotationMatrix[0][1] = ScaleYLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[0][1] / ScaleYLength : 0.0f;
-    RotationMatrix[1][1] = ScaleYLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[1][1] / ScaleYLength : 1.0f;
-    RotationMatrix[2][1] = ScaleYLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[2][1] / ScaleYLength : 0.0f;
-    
-    RotationMatrix[0][2] = ScaleZLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[0][2] / ScaleZLength : 0.0f;
-    RotationMatrix[1][2] = ScaleZLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[1][2] / ScaleZLength : 0.0f;
-    RotationMatrix[2][2] = ScaleZLength > FMath::KINDA_SMALL_NUMBER ? NewTransform[2][2] / ScaleZLength : 1.0f;
-    
-    // 나머지 원소는 0 또는 1로 설정
-    RotationMatrix[3][0] = RotationMatrix[3][1] = RotationMatrix[3][2] = 0.0f;
-    RotationMatrix[0][3] = RotationMatrix[1][3] = RotationMatrix[2][3] = 0.0f;
-    RotationMatrix[3][3] = 1.0f;
-    
-    // 회전 행렬에서 오일러 각 추출 (Z*X*Y 순서 - CreateRotationFromEuler와 일치)
-    FVector Rotation;
-    
-    // Z*X*Y 분해: R = Rz(roll) * Rx(pitch) * Ry(yaw)
-    float pitch = FMath::Asin(FMath::Clamp(RotationMatrix[2][1], -1.0f, 1.0f));
-    
-    if (FMath::Abs(FMath::Cos(pitch)) > FMath::KINDA_SMALL_NUMBER) 
-    {
-        // 일반적인 경우
-        float roll = FMath::Atan2(-RotationMatrix[0][1], RotationMatrix[1][1]);
-        float yaw = FMath::Atan2(-RotationMatrix[2][0], RotationMatrix[2][2]);
-        
-        Rotation.Z = FMath::RadiansToDegrees(roll);   // Roll
-        Rotation.X = FMath::RadiansToDegrees(pitch);  // Pitch  
-        Rotation.Y = FMath::RadiansToDegrees(yaw);    // Yaw
-    } 
-    else 
-    {
-        // Gimbal lock 상황 (pitch = 90도)
-        float roll = FMath::Atan2(RotationMatrix[1][0], RotationMatrix[0][0]);
-        
-        Rotation.Z = FMath::RadiansToDegrees(roll);
-        Rotation.X = FMath::RadiansToDegrees(pitch);
-        Rotation.Y = 0.0f; // Yaw를 0으로 고정
-    }
-    
-    // 추출된 Transform을 RootComponent에 적용
-    RootComponent->SetWorldLocation(Translation);
-    RootComponent->SetWorldRotation(Rotation);
-    RootComponent->SetWorldScale(Scale);
+    RootComponent->SetWorldTransform(FTransform(NewTransform));
 }
 
 UActorComponent* AActor::FindComponentByName(const FName& ComponentName) const
@@ -262,6 +209,7 @@ void AActor::AddComponent(UActorComponent* Component)
     if (Component && Component->IsValid())
     {
         Components.push_back(Component);
+        ReferenceWriteBarrier(Component);
         Component->SetOuter(this);
     }
 }
@@ -305,6 +253,7 @@ void AActor::AttachToActor(AActor* ParentActor)
         
         Owner = ParentActor;
         ParentActor->OwnedActors.push_back(this);
+        ParentActor->ReferenceWriteBarrier(this);
     }
 }
 
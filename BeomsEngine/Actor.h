@@ -9,6 +9,7 @@ class AActor : public UObject
 {
     UCLASS()
     GENERATED_BODY(AActor, UObject)
+    DECLARE_PROPERTIES()
 public:
     AActor();
     virtual ~AActor();
@@ -19,6 +20,10 @@ public:
     virtual void Tick(float DeltaTime) override;
     virtual FString GetClassName() const override { return "AActor"; }
 
+    // GC
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual void BeginDestroy() override;
+
     // Transform 관련 - RootComponent에 위임
     FVector GetActorLocation() const;
     FVector GetActorRotation() const;
@@ -5,6 +5,13 @@
 
 IMPLEMENT_CLASS(UActorComponent, UObject)
 
+BEGIN_PROPERTIES(UActorComponent)
+    UPROPERTY_REGISTER(bIsActive, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bCanEverTick, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bAutoActivate, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bRegistered, EPropertyFlags::Transient)
+END_PROPERTIES()
+
 UActorComponent::UActorComponent()
     : UObject()
     , bIsActive(true)
@@ -25,6 +32,17 @@ UActorComponent::~UActorComponent()
     }
 }
 
+void UActorComponent::BeginDestroy()
+{
+    // Owner가 아직 살아 있을 때 등록 해제 콜백을 호출
+    if (bRegistered)
+    {
+        UnregisterComponent();
+    }
+
+    Super::BeginDestroy();
+}
+
 void UActorComponent::BeginPlay()
 {
     Super::BeginPlay();
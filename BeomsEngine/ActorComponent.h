@@ -10,6 +10,7 @@ class UActorComponent : public UObject
 {
 	UCLASS()
     GENERATED_BODY(UActorComponent, UObject)
+    DECLARE_PROPERTIES()
 public:
     UActorComponent();
     virtual ~UActorComponent();
@@ -19,6 +20,7 @@ public:
     virtual void EndPlay() override; 
     virtual void Tick(float DeltaTime) override;
     virtual FString GetClassName() const override { return "UActorComponent"; }
+    virtual void BeginDestroy() override;
 
     // 컴포넌트 상태
     bool IsActive() const { return bIsActive; }
@@ -1,4 +1,952 @@
 #pragma once
-#include <vector>
+#include "Types.h"
+#include "Memory.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef INDEX_NONE
+#define INDEX_NONE (-1)
+#endif
+
+// memcpy로 옮겨도(relocate) 되는 타입 - 기본은 trivially copyable이며 자기 자신을 가리키지 않는 엔진 타입은 특수화로 추가한다
 template<typename T>
-using TArray = std::vector<T>;
\ No newline at end of file
+struct TIsTriviallyRelocatable
+{
+    static constexpr bool Value = std::is_trivially_copyable_v<T>;
+};
+
+template<typename T>
+void DestructItems(T* Elements, int32 Count)
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Elements[ i ].~T();
+        }
+    }
+}
+
+// Source의 원소들을 겹치지 않는 Dest로 옮기고 Source 쪽은 소멸된 상태로 만든다
+template<typename T>
+void RelocateConstructItems(void* Dest, T* Source, int32 Count)
+{
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    if constexpr (TIsTriviallyRelocatable<T>::Value)
+    {
+        std::memcpy(Dest, Source, sizeof(T) * Count);
+    }
+    else
+    {
+        T* DestElements = static_cast<T*>(Dest);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            new (DestElements + i) T(std::move(Source[ i ]));
+            Source[ i ].~T();
+        }
+    }
+}
+
+// 배열이 가득 찼을 때 새 용량을 정하는 정책
+struct FDefaultGrowthPolicy
+{
+    // 처음에는 4개, 이후 1.5배씩 - push_back을 반복해도 재할당 횟수가 로그 수준으로 유지된다
+    static int32 CalculateSlackGrow(int32 NumElements, int32 NumAllocated)
+    {
+        const int32 Grow = NumAllocated > 0 ? NumAllocated + NumAllocated / 2 : 4;
+        return NumElements > Grow ? NumElements : Grow;
+    }
+};
+
+// 필요한 만큼만 늘린다 - 크기를 미리 알고 Reserve하는 배열이나 여유 공간이 아까운 배열용
+struct FExactGrowthPolicy
+{
+    static int32 CalculateSlackGrow(int32 NumElements, int32 /*NumAllocated*/)
+    {
+        return NumElements;
+    }
+};
+
+// TArray 할당 정책
+// - ForElementType<T>가 실제 메모리를 소유하고, TArray는 원소 수/용량만 관리한다.
+// - ResizeAllocation은 앞쪽 NumUsed개 원소를 새 블록으로 재배치한다.
+
+// FMemory 힙 할당 (현재 스레드의 메모리 태그로 집계)
+template<typename GrowthPolicy = FDefaultGrowthPolicy>
+class THeapAllocator
+{
+public:
+    template<typename T>
+    class ForElementType
+    {
+    public:
+        ForElementType() : Data(nullptr) {}
+        ~ForElementType()
+        {
+            if (Data)
+            {
+                FMemory::Free(Data);
+            }
+        }
+
+        ForElementType(const ForElementType&) = delete;
+        ForElementType& operator=(const ForElementType&) = delete;
+
+        T* GetAllocation() const { return Data; }
+        bool HasAllocation() const { return Data != nullptr; }
+        int32 GetInitialCapacity() const { return 0; }
+
+        void ResizeAllocation(int32 NumUsed, int32 NewMax)
+        {
+            T* NewData = nullptr;
+            if (NewMax > 0)
+            {
+                NewData = static_cast<T*>(FMemory::Malloc(sizeof(T) * NewMax, alignof(T), FMemory::GetCurrentTag()));
+                if (!NewData)
+                {
+                    // 기존 할당은 그대로 두고 std::vector처럼 예외로 알린다
+                    throw std::bad_alloc();
+                }
+            }
+
+            if (Data)
+            {
+                RelocateConstructItems(NewData, Data, NumUsed);
+                FMemory::Free(Data);
+            }
+            Data = NewData;
+        }
+
+        int32 CalculateSlackGrow(int32 NumElements, int32 NumAllocated) const
+        {
+            return GrowthPolicy::CalculateSlackGrow(NumElements, NumAllocated);
+        }
+
+        // Other의 원소를 가져온다 (이 할당은 비어 있어야 한다)
+        void MoveToEmpty(ForElementType& Other, int32 /*NumUsed*/)
+        {
+            Data = Other.Data;
+            Other.Data = nullptr;
+        }
+
+    private:
+        T* Data;
+    };
+};
+
+using FHeapAllocator = THeapAllocator<>;
+using FDefaultAllocator = FHeapAllocator;
+
+// 처음 NumInlineElements개는 배열 객체 안에 저장하고, 넘치면 SecondaryAllocator로 옮긴다
+template<int32 NumInlineElements, typename SecondaryAllocator = FDefaultAllocator>
+class TInlineAllocator
+{
+    static_assert(NumInlineElements > 0, "TInlineAllocator needs at least one inline element");
+
+public:
+    template<typename T>
+    class ForElementType
+    {
+    public:
+        ForElementType() = default;
+
+        ForElementType(const ForElementType&) = delete;
+        ForElementType& operator=(const ForElementType&) = delete;
+
+        T* GetAllocation() const { return Secondary.HasAllocation() ? Secondary.GetAllocation() : GetInlineElements(); }
+        bool HasAllocation() const { return Secondary.HasAllocation(); }
+        int32 GetInitialCapacity() const { return NumInlineElements; }
+
+        void ResizeAllocation(int32 NumUsed, int32 NewMax)
+        {
+            if (NewMax <= NumInlineElements)
+            {
+                // 인라인 버퍼로 돌아온다
+                if (Secondary.HasAllocation())
+                {
+                    RelocateConstructItems(GetInlineElements(), Secondary.GetAllocation(), NumUsed);
+                    Secondary.ResizeAllocation(0, 0);
+                }
+            }
+            else if (Secondary.HasAllocation())
+            {
+                Secondary.ResizeAllocation(NumUsed, NewMax);
+            }
+            else
+            {
+                Secondary.ResizeAllocation(0, NewMax);
+                RelocateConstructItems(Secondary.GetAllocation(), GetInlineElements(), NumUsed);
+            }
+        }
+
+        int32 CalculateSlackGrow(int32 NumElements, int32 NumAllocated) const
+        {
+            if (NumElements <= NumInlineElements)
+            {
+                return NumInlineElements;
+            }
+            return Secondary.CalculateSlackGrow(NumElements, NumAllocated);
+        }
+
+        void MoveToEmpty(ForElementType& Other, int32 NumUsed)
+        {
+            if (Other.Secondary.HasAllocation())
+            {
+                Secondary.MoveToEmpty(Other.Secondary, NumUsed);
+            }
+            else
+            {
+                RelocateConstructItems(GetInlineElements(), Other.GetInlineElements(), NumUsed);
+            }
+        }
+
+    private:
+        alignas(T) uint8 InlineData[ sizeof(T) * NumInlineElements ];
+        typename SecondaryAllocator::template ForElementType<T> Secondary;
+
+        T* GetInlineElements() const { return reinterpret_cast<T*>(const_cast<uint8*>(InlineData)); }
+    };
+};
+
+// std 스타일 할당자(allocate/deallocate)를 할당 정책으로 감싼다 - TArray<T, TMemStackAllocator<T>> 같은 아레나 배열에 사용
+template<typename StlAllocator, typename GrowthPolicy = FDefaultGrowthPolicy>
+class TStlAllocatorAdapter
+{
+public:
+    template<typename T>
+    class ForElementType
+    {
+    public:
+        ForElementType() : Data(nullptr), Capacity(0) {}
+        ~ForElementType()
+        {
+            if (Data)
+            {
+                Allocator.deallocate(Data, Capacity);
+            }
+        }
+
+        ForElementType(const ForElementType&) = delete;
+        ForElementType& operator=(const ForElementType&) = delete;
+
+        T* GetAllocation() const { return Data; }
+        bool HasAllocation() const { return Data != nullptr; }
+        int32 GetInitialCapacity() const { return 0; }
+
+        void ResizeAllocation(int32 NumUsed, int32 NewMax)
+        {
+            T* NewData = NewMax > 0 ? Allocator.allocate(static_cast<size_t>(NewMax)) : nullptr;
+            if (Data)
+            {
+                RelocateConstructItems(NewData, Data, NumUsed);
+                Allocator.deallocate(Data, Capacity);
+            }
+            Data = NewData;
+            Capacity = static_cast<size_t>(NewMax);
+        }
+
+        int32 CalculateSlackGrow(int32 NumElements, int32 NumAllocated) const
+        {
+            return GrowthPolicy::CalculateSlackGrow(NumElements, NumAllocated);
+        }
+
+        // 상태 없는 할당자만 지원하므로 블록을 그대로 가져온다
+        void MoveToEmpty(ForElementType& Other, int32 /*NumUsed*/)
+        {
+            Data = Other.Data;
+            Capacity = Other.Capacity;
+            Other.Data = nullptr;
+            Other.Capacity = 0;
+        }
+
+    private:
+        using FReboundAllocator = typename std::allocator_traits<StlAllocator>::template rebind_alloc<T>;
+
+        T* Data;
+        size_t Capacity;
+        FReboundAllocator Allocator;
+    };
+};
+
+// 할당 정책 선택 - value_type이 있는 std 스타일 할당자는 어댑터로 감싼다
+template<typename Allocator>
+struct TArrayAllocatorPolicy
+{
+    using Type = Allocator;
+};
+
+template<typename Allocator>
+    requires requires { typename Allocator::value_type; }
+struct TArrayAllocatorPolicy<Allocator>
+{
+    using Type = TStlAllocatorAdapter<Allocator>;
+};
+
+// 엔진 동적 배열
+// - 할당 정책으로 힙/인라인/아레나 메모리를 고를 수 있다.
+// - trivially relocatable 원소는 재할당/삭제 시 memcpy/memmove로 옮긴다.
+// - std::vector와 같은 이름의 멤버(begin/end/size/push_back/erase...)를 함께 제공해 기존 코드와 STL 알고리즘이 그대로 동작한다.
+template<typename T, typename Allocator = FDefaultAllocator>
+class TArray
+{
+    template<typename OtherT, typename OtherAllocator>
+    friend class TArray;
+
+    using FElementAllocator = typename TArrayAllocatorPolicy<Allocator>::Type::template ForElementType<T>;
+
+public:
+    using ElementType = T;
+    using AllocatorType = Allocator;
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    TArray()
+        : ArrayNum(0)
+        , ArrayMax(AllocatorInstance.GetInitialCapacity())
+    {
+    }
+
+    explicit TArray(size_t Count) : TArray() { resize(Count); }
+    TArray(size_t Count, const T& Value) : TArray() { assign(Count, Value); }
+    TArray(std::initializer_list<T> InitList) : TArray() { CopyToEmpty(InitList.begin(), static_cast<int32>(InitList.size())); }
+
+    template<std::input_iterator IteratorType>
+    TArray(IteratorType First, IteratorType Last) : TArray() { assign(First, Last); }
+
+    TArray(const TArray& Other) : TArray() { CopyToEmpty(Other.GetData(), Other.ArrayNum); }
+    TArray(TArray&& Other) noexcept : TArray() { MoveToEmpty(Other); }
+
+    template<typename OtherAllocator>
+    explicit TArray(const TArray<T, OtherAllocator>& Other) : TArray() { CopyToEmpty(Other.GetData(), Other.Num()); }
+
+    ~TArray()
+    {
+        DestructItems(GetData(), ArrayNum);
+    }
+
+    TArray& operator=(const TArray& Other)
+    {
+        if (this != &Other)
+        {
+            DestructItems(GetData(), ArrayNum);
+            ArrayNum = 0;
+            CopyToEmpty(Other.GetData(), Other.ArrayNum);
+        }
+        return *this;
+    }
+
+    TArray& operator=(TArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestructItems(GetData(), ArrayNum);
+            ArrayNum = 0;
+            ResizeTo(0);
+            MoveToEmpty(Other);
+        }
+        return *this;
+    }
+
+    TArray& operator=(std::initializer_list<T> InitList)
+    {
+        DestructItems(GetData(), ArrayNum);
+        ArrayNum = 0;
+        CopyToEmpty(InitList.begin(), static_cast<int32>(InitList.size()));
+        return *this;
+    }
+
+    template<typename OtherAllocator>
+    TArray& operator=(const TArray<T, OtherAllocator>& Other)
+    {
+        DestructItems(GetData(), ArrayNum);
+        ArrayNum = 0;
+        CopyToEmpty(Other.GetData(), Other.Num());
+        return *this;
+    }
+
+    // ===== 엔진 스타일 인터페이스 =====
+
+    T* GetData() { return AllocatorInstance.GetAllocation(); }
+    const T* GetData() const { return AllocatorInstance.GetAllocation(); }
+
+    int32 Num() const { return ArrayNum; }
+    int32 Max() const { return ArrayMax; }
+    int32 GetSlack() const { return ArrayMax - ArrayNum; }
+    bool IsEmpty() const { return ArrayNum == 0; }
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < ArrayNum; }
+
+    // 힙(또는 아레나)에서 받은 바이트 수 - 인라인 버퍼만 쓰는 동안은 0
+    size_t GetAllocatedSize() const { return AllocatorInstance.HasAllocation() ? static_cast<size_t>(ArrayMax) * sizeof(T) : 0; }
+
+    T& Last(int32 IndexFromEnd = 0) { return (*this)[ ArrayNum - 1 - IndexFromEnd ]; }
+    const T& Last(int32 IndexFromEnd = 0) const { return (*this)[ ArrayNum - 1 - IndexFromEnd ]; }
+
+    int32 Add(const T& Item) { emplace_back(Item); return ArrayNum - 1; }
+    int32 Add(T&& Item) { emplace_back(std::move(Item)); return ArrayNum - 1; }
+
+    template<typename... ArgsType>
+    int32 Emplace(ArgsType&&... Args)
+    {
+        emplace_back(std::forward<ArgsType>(Args)...);
+        return ArrayNum - 1;
+    }
+
+    int32 AddUnique(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        return Index != INDEX_NONE ? Index : Add(Item);
+    }
+
+    // 생성자를 호출하지 않고 Count개를 늘린다 - trivially copyable 원소를 직접 채울 때 사용
+    int32 AddUninitialized(int32 Count = 1)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "AddUninitialized requires a trivially copyable element type");
+
+        const int32 OldNum = ArrayNum;
+        if (OldNum + Count > ArrayMax)
+        {
+            ResizeGrow(OldNum + Count);
+        }
+        ArrayNum += Count;
+        return OldNum;
+    }
+
+    int32 AddZeroed(int32 Count = 1)
+    {
+        const int32 Index = AddUninitialized(Count);
+        std::memset(GetData() + Index, 0, sizeof(T) * Count);
+        return Index;
+    }
+
+    int32 Find(const T& Item) const
+    {
+        const T* Data = GetData();
+        for (int32 i = 0; i < ArrayNum; ++i)
+        {
+            if (Data[ i ] == Item)
+            {
+                return i;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    bool Contains(const T& Item) const { return Find(Item) != INDEX_NONE; }
+
+    // 순서를 유지하며 제거 (뒤쪽 원소를 앞으로 당긴다)
+    void RemoveAt(int32 Index, int32 Count = 1)
+    {
+        assert(Index >= 0 && Count >= 0 && Index + Count <= ArrayNum);
+
+        T* Data = GetData();
+        if constexpr (TIsTriviallyRelocatable<T>::Value)
+        {
+            DestructItems(Data + Index, Count);
+
+            const int32 NumToMove = ArrayNum - Index - Count;
+            if (NumToMove > 0)
+            {
+                std::memmove(Data + Index, Data + Index + Count, sizeof(T) * NumToMove);
+            }
+        }
+        else if (Count > 0)
+        {
+            // 재배치할 수 없는 타입은 std::vector::erase처럼 이동 대입으로 당기고 남은 꼬리만 소멸시킨다
+            // (원소마다 이동 생성 + 소멸하면 이동 대입보다 몇 배 느리다, Count가 0이면 자기 자신에게 이동 대입하게 된다)
+            std::move(Data + Index + Count, Data + ArrayNum, Data + Index);
+            DestructItems(Data + ArrayNum - Count, Count);
+        }
+        ArrayNum -= Count;
+    }
+
+    // 순서를 유지하지 않고 제거 - 마지막 원소들로 빈자리를 채우므로 O(Count)
+    void RemoveAtSwap(int32 Index, int32 Count = 1)
+    {
+        assert(Index >= 0 && Count >= 0 && Index + Count <= ArrayNum);
+
+        T* Data = GetData();
+        if (Count == 1)
+        {
+            // 가장 흔한 경우 - 크기가 정해진 복사 한 번으로 빈자리를 채운다 (교환 + pop_back과 같은 비용)
+            const int32 LastIndex = ArrayNum - 1;
+            if constexpr (TIsTriviallyRelocatable<T>::Value)
+            {
+                DestructItems(Data + Index, 1);
+                if (Index != LastIndex)
+                {
+                    std::memcpy(static_cast<void*>(Data + Index), Data + LastIndex, sizeof(T));
+                }
+            }
+            else
+            {
+                if (Index != LastIndex)
+                {
+                    Data[ Index ] = std::move(Data[ LastIndex ]);
+                }
+                Data[ LastIndex ].~T();
+            }
+            ArrayNum = LastIndex;
+            return;
+        }
+
+        DestructItems(Data + Index, Count);
+
+        const int32 NumAfterHole = ArrayNum - Index - Count;
+        const int32 NumToMove = Count < NumAfterHole ? Count : NumAfterHole;
+        RelocateConstructItems(Data + Index, Data + ArrayNum - NumToMove, NumToMove);
+        ArrayNum -= Count;
+    }
+
+    // 조건을 만족하는 원소를 모두 제거하고 제거한 수를 돌려준다 (순서 유지)
+    template<typename PredicateType>
+    int32 RemoveAll(PredicateType&& Predicate)
+    {
+        T* Data = GetData();
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < ArrayNum; ++ReadIndex)
+        {
+            if (Predicate(Data[ ReadIndex ]))
+            {
+                continue;
+            }
+
+            if (WriteIndex != ReadIndex)
+            {
+                Data[ WriteIndex ] = std::move(Data[ ReadIndex ]);
+            }
+            ++WriteIndex;
+        }
+
+        const int32 NumRemoved = ArrayNum - WriteIndex;
+        DestructItems(Data + WriteIndex, NumRemoved);
+        ArrayNum = WriteIndex;
+        return NumRemoved;
+    }
+
+    int32 Remove(const T& Item)
+    {
+        // Item이 배열 안의 원소일 수 있으므로 복사해 둔다
+        const T ItemCopy = Item;
+        return RemoveAll([&ItemCopy](const T& Element) { return Element == ItemCopy; });
+    }
+
+    // 처음 찾은 하나를 순서 없이 제거
+    bool RemoveSingleSwap(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        if (Index == INDEX_NONE)
+        {
+            return false;
+        }
+        RemoveAtSwap(Index);
+        return true;
+    }
+
+    void Reserve(int32 Number)
+    {
+        if (Number > ArrayMax)
+        {
+            ResizeTo(Number);
+        }
+    }
+
+    // 원소를 비우고 NewSize 이상의 용량은 유지 (프레임마다 다시 채우는 배열용)
+    void Reset(int32 NewSize = 0)
+    {
+        DestructItems(GetData(), ArrayNum);
+        ArrayNum = 0;
+        if (NewSize > ArrayMax)
+        {
+            ResizeTo(NewSize);
+        }
+    }
+
+    // 원소를 비우고 용량을 Slack으로 맞춘다
+    void Empty(int32 Slack = 0)
+    {
+        DestructItems(GetData(), ArrayNum);
+        ArrayNum = 0;
+        ResizeTo(Slack);
+    }
+
+    void Shrink()
+    {
+        ResizeTo(ArrayNum);
+    }
+
+    void SetNum(int32 NewNum)
+    {
+        resize(static_cast<size_t>(NewNum));
+    }
+
+    T Pop()
+    {
+        T Result = std::move(Last());
+        pop_back();
+        return Result;
+    }
+
+    // ===== std::vector 호환 인터페이스 =====
+
+    iterator begin() { return GetData(); }
+    const_iterator begin() const { return GetData(); }
+    iterator end() { return GetData() + ArrayNum; }
+    const_iterator end() const { return GetData() + ArrayNum; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_t size() const { return static_cast<size_t>(ArrayNum); }
+    size_t capacity() const { return static_cast<size_t>(ArrayMax); }
+    bool empty() const { return ArrayNum == 0; }
+    T* data() { return GetData(); }
+    const T* data() const { return GetData(); }
+
+    T& operator[](size_t Index)
+    {
+        assert(Index < static_cast<size_t>(ArrayNum));
+        return GetData()[ Index ];
+    }
+
+    const T& operator[](size_t Index) const
+    {
+        assert(Index < static_cast<size_t>(ArrayNum));
+        return GetData()[ Index ];
+    }
+
+    T& front() { return (*this)[ 0 ]; }
+    const T& front() const { return (*this)[ 0 ]; }
+    T& back() { return (*this)[ ArrayNum - 1 ]; }
+    const T& back() const { return (*this)[ ArrayNum - 1 ]; }
+
+    void push_back(const T& Item) { emplace_back(Item); }
+    void push_back(T&& Item) { emplace_back(std::move(Item)); }
+
+    template<typename... ArgsType>
+    T& emplace_back(ArgsType&&... Args)
+    {
+        if (ArrayNum == ArrayMax)
+        {
+            return EmplaceBackGrow(std::forward<ArgsType>(Args)...);
+        }
+
+        T* Element = new (GetData() + ArrayNum) T(std::forward<ArgsType>(Args)...);
+        ++ArrayNum;
+        return *Element;
+    }
+
+    void pop_back()
+    {
+        assert(ArrayNum > 0);
+        --ArrayNum;
+        DestructItems(GetData() + ArrayNum, 1);
+    }
+
+    void clear()
+    {
+        DestructItems(GetData(), ArrayNum);
+        ArrayNum = 0;
+    }
+
+    void reserve(size_t Number)
+    {
+        Reserve(static_cast<int32>(Number));
+    }
+
+    void resize(size_t NewSize)
+    {
+        const int32 NewNum = static_cast<int32>(NewSize);
+        if (NewNum > ArrayNum)
+        {
+            if (NewNum > ArrayMax)
+            {
+                ResizeGrow(NewNum);
+            }
+
+            T* Data = GetData();
+            for (int32 i = ArrayNum; i < NewNum; ++i)
+            {
+                new (Data + i) T();
+            }
+        }
+        else
+        {
+            DestructItems(GetData() + NewNum, ArrayNum - NewNum);
+        }
+        ArrayNum = NewNum;
+    }
+
+    void resize(size_t NewSize, const T& Value)
+    {
+        const int32 NewNum = static_cast<int32>(NewSize);
+        if (NewNum > ArrayNum)
+        {
+            if (NewNum > ArrayMax)
+            {
+                // Value가 재할당으로 사라질 원소일 수 있다
+                const T ValueCopy = Value;
+                ResizeGrow(NewNum);
+                std::uninitialized_fill(GetData() + ArrayNum, GetData() + NewNum, ValueCopy);
+            }
+            else
+            {
+                std::uninitialized_fill(GetData() + ArrayNum, GetData() + NewNum, Value);
+            }
+        }
+        else
+        {
+            DestructItems(GetData() + NewNum, ArrayNum - NewNum);
+        }
+        ArrayNum = NewNum;
+    }
+
+    void shrink_to_fit() { Shrink(); }
+
+    iterator erase(const_iterator Position)
+    {
+        const int32 Index = static_cast<int32>(Position - begin());
+        RemoveAt(Index);
+        return begin() + Index;
+    }
+
+    iterator erase(const_iterator First, const_iterator Last)
+    {
+        const int32 Index = static_cast<int32>(First - begin());
+        RemoveAt(Index, static_cast<int32>(Last - First));
+        return begin() + Index;
+    }
+
+    iterator insert(const_iterator Position, const T& Value) { return emplace(Position, Value); }
+    iterator insert(const_iterator Position, T&& Value) { return emplace(Position, std::move(Value)); }
+
+    template<std::forward_iterator IteratorType>
+    iterator insert(const_iterator Position, IteratorType First, IteratorType Last)
+    {
+        const int32 Index = static_cast<int32>(Position - begin());
+        const int32 Count = static_cast<int32>(std::distance(First, Last));
+        if (Count <= 0)
+        {
+            return begin() + Index;
+        }
+
+        // 삽입할 범위가 이 배열 안을 가리키면 재할당/이동 전에 복사해 둔다
+        if constexpr (std::is_pointer_v<IteratorType>)
+        {
+            if (std::to_address(First) >= GetData() && std::to_address(First) < GetData() + ArrayMax)
+            {
+                const TArray Copy(First, Last);
+                return insert(Position, Copy.begin(), Copy.end());
+            }
+        }
+
+        if (ArrayNum + Count > ArrayMax)
+        {
+            ResizeGrow(ArrayNum + Count);
+        }
+
+        T* Data = GetData();
+        OpenHole(Index, Count);
+        std::uninitialized_copy(First, Last, Data + Index);
+        ArrayNum += Count;
+        return Data + Index;
+    }
+
+    iterator insert(const_iterator Position, std::initializer_list<T> InitList)
+    {
+        return insert(Position, InitList.begin(), InitList.end());
+    }
+
+    template<typename... ArgsType>
+    iterator emplace(const_iterator Position, ArgsType&&... Args)
+    {
+        const int32 Index = static_cast<int32>(Position - begin());
+
+        // 인자가 이 배열의 원소를 가리킬 수 있으므로 먼저 만든다
+        T Item(std::forward<ArgsType>(Args)...);
+        if (ArrayNum == ArrayMax)
+        {
+            ResizeGrow(ArrayNum + 1);
+        }
+
+        T* Data = GetData();
+        OpenHole(Index, 1);
+        new (Data + Index) T(std::move(Item));
+        ++ArrayNum;
+        return Data + Index;
+    }
+
+    template<std::input_iterator IteratorType>
+    void assign(IteratorType First, IteratorType Last)
+    {
+        if constexpr (std::forward_iterator<IteratorType>)
+        {
+            TArray Copy;
+            const int32 Count = static_cast<int32>(std::distance(First, Last));
+            Copy.ResizeTo(Count);
+            std::uninitialized_copy(First, Last, Copy.GetData());
+            Copy.ArrayNum = Count;
+            *this = std::move(Copy);
+        }
+        else
+        {
+            clear();
+            for (; First != Last; ++First)
+            {
+                emplace_back(*First);
+            }
+        }
+    }
+
+    void assign(size_t Count, const T& Value)
+    {
+        const T ValueCopy = Value;
+        clear();
+        resize(Count, ValueCopy);
+    }
+
+    void assign(std::initializer_list<T> InitList)
+    {
+        *this = InitList;
+    }
+
+    void swap(TArray& Other)
+    {
+        TArray Temp(std::move(Other));
+        Other = std::move(*this);
+        *this = std::move(Temp);
+    }
+
+    friend void swap(TArray& A, TArray& B) { A.swap(B); }
+
+    bool operator==(const TArray& Other) const
+    {
+        return ArrayNum == Other.ArrayNum && std::equal(begin(), end(), Other.begin());
+    }
+
+    bool operator!=(const TArray& Other) const { return !(*this == Other); }
+
+private:
+    FElementAllocator AllocatorInstance;
+    int32 ArrayNum;
+    int32 ArrayMax;
+
+    // 용량을 NewMax(할당 정책의 최소 용량 이상)로 바꾼다
+    void ResizeTo(int32 NewMax)
+    {
+        const int32 InitialCapacity = AllocatorInstance.GetInitialCapacity();
+        if (NewMax < InitialCapacity)
+        {
+            NewMax = InitialCapacity;
+        }
+        if (NewMax < ArrayNum)
+        {
+            NewMax = ArrayNum;
+        }
+
+        if (NewMax != ArrayMax || (NewMax == InitialCapacity && AllocatorInstance.HasAllocation()))
+        {
+            AllocatorInstance.ResizeAllocation(ArrayNum, NewMax);
+            ArrayMax = NewMax;
+        }
+    }
+
+    // NumElements 이상이 들어가도록 성장 정책에 따라 늘린다
+    void ResizeGrow(int32 NumElements)
+    {
+        ResizeTo(AllocatorInstance.CalculateSlackGrow(NumElements, ArrayMax));
+    }
+
+    template<typename... ArgsType>
+    T& EmplaceBackGrow(ArgsType&&... Args)
+    {
+        // 인자가 재할당으로 옮겨질 원소를 가리킬 수 있으므로 새 블록에 옮기기 전에 만든다
+        T Item(std::forward<ArgsType>(Args)...);
+        ResizeGrow(ArrayNum + 1);
+
+        T* Element = new (GetData() + ArrayNum) T(std::move(Item));
+        ++ArrayNum;
+        return *Element;
+    }
+
+    // [Index, ArrayNum) 원소를 Count칸 뒤로 옮긴다 (용량은 확보되어 있어야 한다)
+    void OpenHole(int32 Index, int32 Count)
+    {
+        T* Data = GetData();
+        const int32 NumToMove = ArrayNum - Index;
+        if constexpr (TIsTriviallyRelocatable<T>::Value)
+        {
+            std::memmove(Data + Index + Count, Data + Index, sizeof(T) * NumToMove);
+        }
+        else
+        {
+            for (int32 i = NumToMove - 1; i >= 0; --i)
+            {
+                new (Data + Index + Count + i) T(std::move(Data[ Index + i ]));
+                Data[ Index + i ].~T();
+            }
+        }
+    }
+
+    void CopyToEmpty(const T* Source, int32 Count)
+    {
+        if (Count > ArrayMax)
+        {
+            ResizeTo(Count);
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (Count > 0)
+            {
+                std::memcpy(GetData(), Source, sizeof(T) * Count);
+            }
+        }
+        else
+        {
+            std::uninitialized_copy(Source, Source + Count, GetData());
+        }
+        ArrayNum = Count;
+    }
+
+    void MoveToEmpty(TArray& Other)
+    {
+        AllocatorInstance.MoveToEmpty(Other.AllocatorInstance, Other.ArrayNum);
+        ArrayNum = Other.ArrayNum;
+        ArrayMax = Other.ArrayMax;
+
+        Other.ArrayNum = 0;
+        Other.ArrayMax = Other.AllocatorInstance.GetInitialCapacity();
+    }
+};
+
+// 힙 배열은 포인터와 크기만 가지므로 memcpy로 옮겨도 된다 (인라인 배열은 자기 버퍼를 가리키므로 제외)
+template<typename T, typename GrowthPolicy>
+struct TIsTriviallyRelocatable<TArray<T, THeapAllocator<GrowthPolicy>>>
+{
+    static constexpr bool Value = true;
+};
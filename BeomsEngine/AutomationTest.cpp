@@ -0,0 +1,59 @@
+#include "pch.h"
+#include "AutomationTest.h"
+#include "Benchmark.h"
+#include <cstring>
+
+namespace
+{
+    struct FTestEntry
+    {
+        const char* Name;
+        FAutomationTest::FTestFunction Function;
+    };
+
+    // 정적 초기화 순서와 무관하도록 함수 안의 정적 변수로 둔다
+    TArray<FTestEntry>& GetTests()
+    {
+        static TArray<FTestEntry> Tests;
+        return Tests;
+    }
+
+    int32 GNumFailuresInCurrentTest = 0;
+}
+
+void FAutomationTest::Register(const char* Name, FTestFunction Function)
+{
+    GetTests().Add({ Name, Function });
+}
+
+int32 FAutomationTest::RunAll(const char* Filter)
+{
+    int32 NumRun = 0;
+    int32 NumFailed = 0;
+    for (const FTestEntry& Entry : GetTests())
+    {
+        if (Filter && Filter[ 0 ] && !std::strstr(Entry.Name, Filter))
+        {
+            continue;
+        }
+
+        GNumFailuresInCurrentTest = 0;
+        Entry.Function();
+        ++NumRun;
+
+        if (GNumFailuresInCurrentTest > 0)
+        {
+            ++NumFailed;
+        }
+        FBenchmark::Report("[%s] %s\n", GNumFailuresInCurrentTest > 0 ? "FAIL" : " OK ", Entry.Name);
+    }
+
+    FBenchmark::Report("%d tests, %d failed\n", NumRun, NumFailed);
+    return NumFailed;
+}
+
+void FAutomationTest::AddFailure(const char* File, int32 Line, const char* Expression)
+{
+    ++GNumFailuresInCurrentTest;
+    FBenchmark::Report("  %s(%d): TEST_CHECK(%s) failed\n", File, Line, Expression);
+}
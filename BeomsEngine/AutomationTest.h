@@ -0,0 +1,33 @@
+#pragma once
+#include "Types.h"
+
+// 엔진 내부 자동화 테스트
+// 테스트 코드는 대상 옆의 *Tests.cpp에 두고 IMPLEMENT_TEST로 등록한다.
+// 실행: BeomsEngine.exe -test [이름 필터]
+class FAutomationTest
+{
+public:
+    using FTestFunction = void(*)();
+
+    struct FRegistrar
+    {
+        FRegistrar(const char* Name, FTestFunction Function) { Register(Name, Function); }
+    };
+
+    static void Register(const char* Name, FTestFunction Function);
+
+    // 이름에 Filter가 포함된 테스트만 실행 (nullptr 또는 빈 문자열이면 전부), 실패한 테스트 수를 반환
+    static int32 RunAll(const char* Filter = nullptr);
+
+    // 실행 중인 테스트에 실패를 기록 (TEST_CHECK가 호출)
+    static void AddFailure(const char* File, int32 Line, const char* Expression);
+};
+
+#define IMPLEMENT_TEST(Name) \
+    static void Test_##Name(); \
+    static FAutomationTest::FRegistrar TestRegistrar_##Name(#Name, &Test_##Name); \
+    static void Test_##Name()
+
+// 실패해도 테스트를 계속 진행한다
+#define TEST_CHECK(Expression) \
+    do { if (!(Expression)) { FAutomationTest::AddFailure(__FILE__, __LINE__, #Expression); } } while (0)
@@ -0,0 +1,68 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    struct FBenchmarkEntry
+    {
+        const char* Name;
+        FBenchmark::FBenchmarkFunction Function;
+    };
+
+    // 정적 초기화 순서와 무관하도록 함수 안의 정적 변수로 둔다
+    TArray<FBenchmarkEntry>& GetBenchmarks()
+    {
+        static TArray<FBenchmarkEntry> Benchmarks;
+        return Benchmarks;
+    }
+}
+
+void FBenchmark::Register(const char* Name, FBenchmarkFunction Function)
+{
+    GetBenchmarks().Add({ Name, Function });
+}
+
+int32 FBenchmark::RunAll(const char* Filter)
+{
+    int32 NumRun = 0;
+    for (const FBenchmarkEntry& Entry : GetBenchmarks())
+    {
+        if (Filter && Filter[ 0 ] && !std::strstr(Entry.Name, Filter))
+        {
+            continue;
+        }
+
+        Report("== %s\n", Entry.Name);
+        Entry.Function();
+        ++NumRun;
+    }
+    return NumRun;
+}
+
+#if defined(_MSC_VER) && !defined(__clang__)
+__declspec(noinline)
+#endif
+void FBenchmark::ConsumeAddress(const volatile char* Address)
+{
+    // 링크 타임 최적화로 인라인되지 않는 한 호출한 쪽은 Address가 가리키는 값을 계산해 두어야 한다
+    (void)Address;
+}
+
+void FBenchmark::Report(const char* Format, ...)
+{
+    char Buffer[ 512 ];
+
+    va_list Args;
+    va_start(Args, Format);
+    vsnprintf(Buffer, sizeof(Buffer), Format, Args);
+    va_end(Args);
+
+    fputs(Buffer, stdout);
+    fflush(stdout);
+#ifdef _WIN32
+    OutputDebugStringA(Buffer);
+#endif
+}
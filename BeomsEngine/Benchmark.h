@@ -0,0 +1,94 @@
+#pragma once
+#include "Types.h"
+#include "Containers.h"
+#include <chrono>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// 엔진 내부 마이크로벤치마크
+// 측정 코드는 측정 대상 옆의 *Benchmarks.cpp에 두고 IMPLEMENT_BENCHMARK로 등록한다.
+// 실행: BeomsEngine.exe -benchmark [이름 필터] (Release 빌드에서 측정할 것)
+class FBenchmark
+{
+public:
+    using FBenchmarkFunction = void(*)();
+
+    struct FRegistrar
+    {
+        FRegistrar(const char* Name, FBenchmarkFunction Function) { Register(Name, Function); }
+    };
+
+    static void Register(const char* Name, FBenchmarkFunction Function);
+
+    // 이름에 Filter가 포함된 벤치마크만 실행 (nullptr 또는 빈 문자열이면 전부), 실행한 개수를 반환
+    static int32 RunAll(const char* Filter = nullptr);
+
+    // 결과 한 줄 출력 (콘솔 + 디버거 출력 창)
+    static void Report(const char* Format, ...);
+
+    static double NowMicroseconds()
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+    }
+
+    // Function을 NumRuns번 실행해 가장 짧은 시간(마이크로초)을 반환
+    template<typename FunctionType>
+    static double MeasureBest(int32 NumRuns, FunctionType&& Function)
+    {
+        double Best = 1e30;
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            const double Start = NowMicroseconds();
+            Function();
+            Best = std::min(Best, NowMicroseconds() - Start);
+        }
+        return Best;
+    }
+
+    // 두 구현을 번갈아 NumRuns번씩 실행해 각각 가장 짧은 시간을 반환
+    // 할당자 상태나 캐시가 먼저 실행한 쪽에 유리하게 남지 않도록 매 회 순서를 뒤집는다
+    template<typename FunctionTypeA, typename FunctionTypeB>
+    static TPair<double, double> MeasureBestInterleaved(int32 NumRuns, FunctionTypeA&& FunctionA, FunctionTypeB&& FunctionB)
+    {
+        double BestA = 1e30;
+        double BestB = 1e30;
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            if (Run & 1)
+            {
+                BestB = std::min(BestB, MeasureBest(1, FunctionB));
+                BestA = std::min(BestA, MeasureBest(1, FunctionA));
+            }
+            else
+            {
+                BestA = std::min(BestA, MeasureBest(1, FunctionA));
+                BestB = std::min(BestB, MeasureBest(1, FunctionB));
+            }
+        }
+        return TPair<double, double>(BestA, BestB);
+    }
+
+    // 결과를 쓰지 않는 계산이 최적화로 사라지지 않게 한다
+    // 값을 컴파일러가 볼 수 없는 곳에서 읽는 것처럼 만들 뿐 실제로 메모리에 쓰지 않는다
+    template<typename T>
+    static void Consume(const T& Value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        // MSVC x64에는 인라인 asm이 없으므로 인라인되지 않는 함수에 주소를 넘기고 재배치를 막는다
+        ConsumeAddress(&reinterpret_cast<const volatile char&>(Value));
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(Value) : "memory");
+#endif
+    }
+
+private:
+    static void ConsumeAddress(const volatile char* Address);
+};
+
+#define IMPLEMENT_BENCHMARK(Name) \
+    static void Benchmark_##Name(); \
+    static FBenchmark::FRegistrar BenchmarkRegistrar_##Name(#Name, &Benchmark_##Name); \
+    static void Benchmark_##Name()
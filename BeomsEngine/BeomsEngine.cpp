@@ -1,6 +1,8 @@
 #include <iostream>
 #include "pch.h"
 #include "BeomsEngine.h"
+#include "AutomationTest.h"
+#include "Benchmark.h"
 
 #define MAX_LOADSTRING 100
 
@@ -13,12 +15,18 @@ ATOM                MyRegisterClass(HINSTANCE hInstance);
 BOOL                InitInstance(HINSTANCE, int);
 LRESULT CALLBACK    WndProc(HWND, UINT, WPARAM, LPARAM);
 INT_PTR CALLBACK    About(HWND, UINT, WPARAM, LPARAM);
+bool                RunCommandLineTools(LPCWSTR CommandLine);
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                      _In_opt_ HINSTANCE hPrevInstance,
                      _In_ LPWSTR    lpCmdLine,
                      _In_ int       nCmdShow)
 {
+    if (RunCommandLineTools(lpCmdLine))
+    {
+        return 0;
+    }
+
     LoadStringW(hInstance, IDS_APP_TITLE, szTitle, MAX_LOADSTRING);
     LoadStringW(hInstance, IDC_BEOMSENGINE, szWindowClass, MAX_LOADSTRING);
     MyRegisterClass(hInstance);
@@ -44,6 +52,54 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     return (int) msg.wParam;
 }
 
+// CommandLine이 Switch로 시작하면 뒤따르는 필터를 OutFilter에 UTF-8로 복사하고 true
+static bool ParseToolSwitch(LPCWSTR CommandLine, const WCHAR* Switch, char* OutFilter, int32 FilterSize)
+{
+    const size_t SwitchLength = wcslen(Switch);
+    if (!CommandLine || wcsncmp(CommandLine, Switch, SwitchLength) != 0)
+    {
+        return false;
+    }
+
+    const WCHAR* FilterStart = CommandLine + SwitchLength;
+    while (*FilterStart == L' ')
+    {
+        ++FilterStart;
+    }
+    WideCharToMultiByte(CP_UTF8, 0, FilterStart, -1, OutFilter, FilterSize - 1, nullptr, nullptr);
+    return true;
+}
+
+// -benchmark [필터] 또는 -test [필터]로 실행하면 창을 만들지 않고 등록된 벤치마크/테스트만 돌린 뒤 종료한다
+bool RunCommandLineTools(LPCWSTR CommandLine)
+{
+    char Filter[ 128 ] = {};
+    const bool bBenchmark = ParseToolSwitch(CommandLine, L"-benchmark", Filter, sizeof(Filter));
+    const bool bTest = !bBenchmark && ParseToolSwitch(CommandLine, L"-test", Filter, sizeof(Filter));
+    if (!bBenchmark && !bTest)
+    {
+        return false;
+    }
+
+    AllocConsole();
+    FILE* Stream = nullptr;
+    freopen_s(&Stream, "CONOUT$", "w", stdout);
+    freopen_s(&Stream, "CONIN$", "r", stdin);
+
+    if (bBenchmark)
+    {
+        FBenchmark::RunAll(Filter);
+    }
+    else
+    {
+        FAutomationTest::RunAll(Filter);
+    }
+
+    printf("\nPress Enter to exit...");
+    getchar();
+    return true;
+}
+
 ATOM MyRegisterClass(HINSTANCE hInstance)
 {
     WNDCLASSEXW wcex;
@@ -0,0 +1,43 @@
+#include "pch.h"
+#include "BoxSphereBounds.h"
+#include "VectorKernels.h"
+#include "MemStack.h"
+
+FBoxSphereBounds::FBoxSphereBounds(const TArray<FVertex>& Vertices)
+    : FBoxSphereBounds()
+{
+    const int32 NumVertices = Vertices.Num();
+    if (NumVertices == 0)
+    {
+        return;
+    }
+
+    // 임시 SoA 버퍼는 프레임 아레나에서 받고 스코프가 끝나면 되돌린다
+    FMemMark Mark(FMemStack::Get());
+    float* X = FMemStack::Get().Alloc<float>(NumVertices);
+    float* Y = FMemStack::Get().Alloc<float>(NumVertices);
+    float* Z = FMemStack::Get().Alloc<float>(NumVertices);
+    FVectorKernels::DeinterleavePositions(Vertices.GetData(), NumVertices, X, Y, Z);
+
+    // 바운딩 박스 계산
+    FVector MinBounds;
+    FVector MaxBounds;
+    FVectorKernels::ComputeMinMax(X, Y, Z, NumVertices, MinBounds, MaxBounds);
+
+    Origin = (MinBounds + MaxBounds) * 0.5f;
+    BoxExtent = (MaxBounds - MinBounds) * 0.5f;
+
+    // 바운딩 스피어 반지름 계산
+    SphereRadius = std::sqrt(FVectorKernels::ComputeMaxDistanceSquared(X, Y, Z, NumVertices, Origin));
+}
+
+FBoxSphereBounds FBoxSphereBounds::TransformBy(const FMatrix& Transform) const
+{
+    FBoxSphereBounds Result;
+    FVectorKernels::TransformBoxes(Transform, &Origin, &BoxExtent, &Result.Origin, &Result.BoxExtent, 1);
+
+    // 늘어난 스피어와 새 박스의 외접구 중 작은 쪽 (둘 다 변환된 정점을 모두 포함한다)
+    const float ScaledRadius = SphereRadius * FVectorKernels::GetMaximumAxisScale(Transform);
+    Result.SphereRadius = std::min(ScaledRadius, Result.BoxExtent.Magnitude());
+    return Result;
+}
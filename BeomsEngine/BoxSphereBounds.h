@@ -1,5 +1,6 @@
 #pragma once
 #include "Math.h"
+#include "Matrix.h"
 #include "Vertex.h"
 
 // 바운딩 박스와 바운딩 스피어를 결합한 구조체
@@ -21,44 +22,8 @@ struct FBoxSphereBounds
         , SphereRadius(InSphereRadius)
     {}
 
-    // 정점 배열로부터 바운딩 계산
-    FBoxSphereBounds(const TArray<struct FVertex>& Vertices)
-    {
-        if (Vertices.empty())
-        {
-            *this = FBoxSphereBounds();
-            return;
-        }
-
-        // 최소/최대 찾기
-        FVector MinBounds = Vertices[0].Position;
-        FVector MaxBounds = Vertices[0].Position;
-
-        for (const auto& Vertex : Vertices)
-        {
-            MinBounds.X = fmin(MinBounds.X, Vertex.Position.X);
-            MinBounds.Y = fmin(MinBounds.Y, Vertex.Position.Y);
-            MinBounds.Z = fmin(MinBounds.Z, Vertex.Position.Z);
-
-            MaxBounds.X = fmax(MaxBounds.X, Vertex.Position.X);
-            MaxBounds.Y = fmax(MaxBounds.Y, Vertex.Position.Y);
-            MaxBounds.Z = fmax(MaxBounds.Z, Vertex.Position.Z);
-        }
-
-        // 바운딩 박스 계산
-        Origin = (MinBounds + MaxBounds) * 0.5f;
-        BoxExtent = (MaxBounds - MinBounds) * 0.5f;
-
-        // 바운딩 스피어 반지름 계산
-        float MaxDistanceSquared = 0.0f;
-        for (const auto& Vertex : Vertices)
-        {
-            FVector Diff = Vertex.Position - Origin;
-            float DistanceSquared = Diff.X * Diff.X + Diff.Y * Diff.Y + Diff.Z * Diff.Z;
-            MaxDistanceSquared = fmax(MaxDistanceSquared, DistanceSquared);
-        }
-        SphereRadius = sqrt(MaxDistanceSquared);
-    }
+    // 정점 배열로부터 바운딩 계산 (위치를 SoA로 풀어 SIMD로 최소/최대와 반지름을 구한다)
+    FBoxSphereBounds(const TArray<struct FVertex>& Vertices);
 
     // 바운딩 박스 최소점 반환
     FVector GetBoxMin() const
@@ -110,13 +75,9 @@ struct FBoxSphereBounds
         return FBoxSphereBounds(NewOrigin, NewBoxExtent, NewSphereRadius);
     }
 
-    // 변환 적용
-    FBoxSphereBounds TransformBy(const FMatrix& Transform) const
-    {
-        // TODO: 실제 매트릭스 변환 구현
-        // 현재는 단순화된 버전
-        return *this;
-    }
+    // 변환 적용 - 박스는 Arvo 방법으로 다시 감싸고, 스피어는 최대 축 배율만큼 키운다
+    // 아핀 행렬을 가정한다 (투영 행렬은 지원하지 않음)
+    FBoxSphereBounds TransformBy(const FMatrix& Transform) const;
 
     // 유효성 검사
     bool IsValid() const
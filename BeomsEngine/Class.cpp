@@ -1,40 +1,47 @@
 #include "pch.h"
 #include "Class.h"
 #include "Object.h"
+#include "UObjectArray.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
 
 // 정적 멤버 정의
 TArray<UClass*> UClass::RegisteredClasses;
 TMap<FName, UClass*> UClass::ClassMap;
 
+// 클래스는 워커 스레드에서 처음 생성될 때 등록될 수 있으므로 레지스트리 접근을 직렬화한다
+static std::mutex ClassRegistryMutex;
+
 UClass::UClass(const FName& InClassName, UClass* InSuperClass, ClassConstructorType InConstructor)
     : ClassName(InClassName)
     , SuperClass(InSuperClass)
     , Constructor(InConstructor)
+    , ClassDepth(InSuperClass ? InSuperClass->ClassDepth + 1 : 0)
+    , ClassBaseChain{}
+    , PODPropertiesSize(0)
     , bChildClassesCached(false)
 {
-}
+    // 조상 배열은 고정 크기이므로 Release 빌드에서도 넘치기 전에 등록을 중단한다
+    // (GetStaticClass의 정적 초기화에서 던져지므로 잡히지 않으면 시작 시점에 종료된다)
+    if (ClassDepth >= MaxClassDepth)
+    {
+        throw std::length_error("Class hierarchy of " + InClassName.ToString() + " is deeper than UClass::MaxClassDepth (" + std::to_string(MaxClassDepth) + ")");
+    }
 
-UClass::~UClass()
-{
+    // 부모 클래스는 IMPLEMENT_CLASS에서 먼저 생성되므로 부모의 조상 배열을 그대로 이어받는다
+    if (SuperClass)
+    {
+        for (int32 i = 0; i < ClassDepth; ++i)
+        {
+            ClassBaseChain[ i ] = SuperClass->ClassBaseChain[ i ];
+        }
+    }
+    ClassBaseChain[ ClassDepth ] = this;
 }
 
-bool UClass::IsChildOf(const UClass* SomeBase) const
+UClass::~UClass()
 {
-    if (!SomeBase)
-        return false;
-        
-    if (this == SomeBase)
-        return true;
-        
-    const UClass* CurrentClass = SuperClass;
-    while (CurrentClass)
-    {
-        if (CurrentClass == SomeBase)
-            return true;
-        CurrentClass = CurrentClass->SuperClass;
-    }
-    
-    return false;
 }
 
 bool UClass::IsChildOf(const FName& BaseClassName) const
@@ -47,6 +54,8 @@ UObject* UClass::CreateDefaultObject() const
 {
     if (Constructor)
     {
+        // UObject 생성자가 GUObjectArray에 등록하면서 이 클래스의 목록에 바로 넣도록 알린다
+        FUObjectArray::SetClassOfNextObject(this);
         return Constructor();
     }
     return nullptr;
@@ -56,13 +65,24 @@ void UClass::RegisterClass(UClass* NewClass)
 {
     if (NewClass)
     {
+        // 프로퍼티 등록이 끝났으므로 상속 포함 레이아웃을 확정 (부모는 이미 등록되어 있다)
+        NewClass->BuildPropertyLayout();
+
+        std::lock_guard<std::mutex> Lock(ClassRegistryMutex);
         RegisteredClasses.push_back(NewClass);
         ClassMap[NewClass->GetName()] = NewClass;
+
+        // 클래스는 처음 사용될 때 등록되므로 조상들의 자식 클래스 캐시를 무효화
+        for (UClass* Super = NewClass->SuperClass; Super; Super = Super->SuperClass)
+        {
+            Super->bChildClassesCached = false;
+        }
     }
 }
 
 UClass* UClass::FindClass(const FName& ClassName)
 {
+    std::lock_guard<std::mutex> Lock(ClassRegistryMutex);
     auto it = ClassMap.find(ClassName);
     if (it != ClassMap.end())
     {
@@ -73,6 +93,7 @@ UClass* UClass::FindClass(const FName& ClassName)
 
 void UClass::GetAllChildClasses(TArray<UClass*>& OutChildClasses) const
 {
+    std::lock_guard<std::mutex> Lock(ClassRegistryMutex);
     if (!bChildClassesCached)
     {
         CacheChildClasses();
@@ -83,6 +104,7 @@ void UClass::GetAllChildClasses(TArray<UClass*>& OutChildClasses) const
 
 bool UClass::HasChildren() const
 {
+    std::lock_guard<std::mutex> Lock(ClassRegistryMutex);
     if (!bChildClassesCached)
     {
         CacheChildClasses();
@@ -104,4 +126,122 @@ void UClass::CacheChildClasses() const
     }
     
     bChildClassesCached = true;
+}
+
+void UClass::AddProperty(const FProperty& Property)
+{
+    Properties.push_back(Property);
+}
+
+void UClass::GetAllProperties(TArray<const FProperty*>& OutProperties) const
+{
+    OutProperties.clear();
+    for (int32 Depth = 0; Depth <= ClassDepth; ++Depth)
+    {
+        for (const FProperty& Property : ClassBaseChain[ Depth ]->Properties)
+        {
+            OutProperties.push_back(&Property);
+        }
+    }
+}
+
+const FProperty* UClass::FindProperty(const FName& PropertyName) const
+{
+    for (int32 Depth = ClassDepth; Depth >= 0; --Depth)
+    {
+        for (const FProperty& Property : ClassBaseChain[ Depth ]->Properties)
+        {
+            if (Property.Name == PropertyName)
+            {
+                return &Property;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void UClass::BuildPropertyLayout()
+{
+    TArray<const FProperty*> AllProperties;
+    GetAllProperties(AllProperties);
+
+    TArray<FPropertyRange> Ranges;
+    for (const FProperty* Property : AllProperties)
+    {
+        if (Property->IsPOD() && !Property->HasAnyFlags(EPropertyFlags::Transient))
+        {
+            Ranges.push_back({ Property->Offset, Property->Size });
+        }
+    }
+
+    // 오프셋 순으로 정렬한 뒤 바로 붙어 있는 구간을 합친다
+    std::sort(Ranges.begin(), Ranges.end(), [](const FPropertyRange& A, const FPropertyRange& B) { return A.Offset < B.Offset; });
+
+    PODRanges.clear();
+    PODPropertiesSize = 0;
+    for (const FPropertyRange& Range : Ranges)
+    {
+        if (!PODRanges.empty() && PODRanges.back().Offset + PODRanges.back().Size == Range.Offset)
+        {
+            PODRanges.back().Size += Range.Size;
+        }
+        else
+        {
+            PODRanges.push_back(Range);
+        }
+        PODPropertiesSize += Range.Size;
+    }
+}
+
+void UClass::SerializePODProperties(const UObject* Object, TArray<uint8>& OutBytes) const
+{
+    OutBytes.resize(PODPropertiesSize);
+
+    const uint8* Source = reinterpret_cast<const uint8*>(Object);
+    uint8* Dest = OutBytes.data();
+    for (const FPropertyRange& Range : PODRanges)
+    {
+        std::memcpy(Dest, Source + Range.Offset, Range.Size);
+        Dest += Range.Size;
+    }
+}
+
+bool UClass::DeserializePODProperties(UObject* Object, const uint8* Data, size_t DataSize) const
+{
+    // 레이아웃이 다른 데이터는 거부
+    if (!Object || !Object->IsA(this) || DataSize != PODPropertiesSize)
+    {
+        return false;
+    }
+
+    uint8* Dest = reinterpret_cast<uint8*>(Object);
+    for (const FPropertyRange& Range : PODRanges)
+    {
+        std::memcpy(Dest + Range.Offset, Data, Range.Size);
+        Data += Range.Size;
+    }
+
+    // POD 구간에는 오브젝트 참조가 없으므로 쓰기 배리어는 필요 없고, 파생 상태만 다시 맞춘다
+    Object->PostLoad();
+    return true;
+}
+
+void UClass::GetChangedProperties(const UObject* ObjectA, const UObject* ObjectB, TArray<const FProperty*>& OutChangedProperties) const
+{
+    OutChangedProperties.clear();
+    if (!ObjectA || !ObjectB || !ObjectA->IsA(this) || !ObjectB->IsA(this))
+    {
+        return;
+    }
+
+    for (int32 Depth = 0; Depth <= ClassDepth; ++Depth)
+    {
+        for (const FProperty& Property : ClassBaseChain[ Depth ]->Properties)
+        {
+            if (!Property.HasAnyFlags(EPropertyFlags::Transient) && !Property.Identical(ObjectA, ObjectB))
+            {
+                OutChangedProperties.push_back(&Property);
+            }
+        }
+    }
 }
\ No newline at end of file
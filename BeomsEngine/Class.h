@@ -2,6 +2,7 @@
 #include "Containers.h"
 #include "Types.h"
 #include "Name.h"
+#include "Property.h"
 
 #ifdef RegisterClass
 #undef RegisterClass
@@ -18,6 +19,9 @@ typedef UObject* (*ClassConstructorType)();
 class UClass
 {
 public:
+    // 지원하는 최대 상속 깊이 (UObject = 0) - 넘으면 UClass 생성자가 std::length_error를 던진다
+    static constexpr int32 MaxClassDepth = 16;
+
     UClass(const FName& InClassName, UClass* InSuperClass, ClassConstructorType InConstructor);
     ~UClass();
 
@@ -25,9 +29,14 @@ public:
     const FName& GetName() const { return ClassName; }
     FString GetNameString() const { return ClassName.ToString(); }
     UClass* GetSuperClass() const { return SuperClass; }
+    int32 GetClassDepth() const { return ClassDepth; }
     
     // 상속 관계 확인
-    bool IsChildOf(const UClass* SomeBase) const;
+    // SomeBase가 조상이라면 이 클래스의 조상 배열에서 SomeBase의 깊이 위치에 SomeBase가 있다 (범위 검사 + 비교 한 번)
+    bool IsChildOf(const UClass* SomeBase) const
+    {
+        return SomeBase && SomeBase->ClassDepth <= ClassDepth && ClassBaseChain[ SomeBase->ClassDepth ] == SomeBase;
+    }
     bool IsChildOf(const FName& BaseClassName) const;
 
     // 오브젝트 생성
@@ -41,19 +50,49 @@ public:
     // 클래스 계층구조 정보
     void GetAllChildClasses(TArray<UClass*>& OutChildClasses) const;
     bool HasChildren() const;
+
+    // 리플렉션 프로퍼티 - StaticRegisterProperties에서 등록되고 RegisterClass에서 레이아웃이 확정된다
+    void AddProperty(const FProperty& Property);
+    const TArray<FProperty>& GetOwnProperties() const { return Properties; }
+
+    // 부모 클래스의 프로퍼티부터 순서대로 (상속 포함)
+    void GetAllProperties(TArray<const FProperty*>& OutProperties) const;
+
+    // 자식 클래스의 프로퍼티가 같은 이름의 부모 프로퍼티를 가린다
+    const FProperty* FindProperty(const FName& PropertyName) const;
+
+    // POD 프로퍼티 일괄 저장/복원 - 연속 구간마다 memcpy 한 번 (Transient 제외, 상속 포함)
+    // 복원 후에는 오브젝트의 PostLoad를 호출한다
+    uint32 GetPODPropertiesSize() const { return PODPropertiesSize; }
+    void SerializePODProperties(const UObject* Object, TArray<uint8>& OutBytes) const;
+    bool DeserializePODProperties(UObject* Object, const uint8* Data, size_t DataSize) const;
+
+    // 같은 클래스의 두 오브젝트에서 값이 다른 프로퍼티 (Transient 제외)
+    void GetChangedProperties(const UObject* ObjectA, const UObject* ObjectB, TArray<const FProperty*>& OutChangedProperties) const;
     
+
 private:
     FName ClassName;
     UClass* SuperClass;
     ClassConstructorType Constructor;
 
+    // 루트부터 자기 자신까지의 조상 (ClassBaseChain[ i ] = 깊이 i의 조상, ClassBaseChain[ ClassDepth ] = this)
+    int32 ClassDepth;
+    const UClass* ClassBaseChain[ MaxClassDepth ];
+
     // 전역 클래스 레지스트리
     static TArray<UClass*> RegisteredClasses;
     static TMap<FName, UClass*> ClassMap;
     
+    // 이 클래스에서 선언한 프로퍼티와 상속 포함 POD 구간
+    TArray<FProperty> Properties;
+    TArray<FPropertyRange> PODRanges;
+    uint32 PODPropertiesSize;
+
     // 자식 클래스들 (캐시)
     mutable TArray<UClass*> ChildClasses;
     mutable bool bChildClassesCached;
     
     void CacheChildClasses() const;
+    void BuildPropertyLayout();
 };
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "pch.h"
+#include "AutomationTest.h"
+#include "Class.h"
+#include "Object.h"
+#include <memory>
+#include <stdexcept>
+
+// 조상 배열에 들어가지 않는 깊이의 클래스는 Release 빌드에서도 만들어지지 않는다
+IMPLEMENT_TEST(Class_RejectsHierarchyDeeperThanMaxClassDepth)
+{
+    // 등록하지 않은 클래스만 만들어 전역 레지스트리에는 흔적이 남지 않는다
+    TArray<std::unique_ptr<UClass>> Chain;
+    UClass* Super = UObject::GetStaticClass();
+    while (Super->GetClassDepth() + 1 < UClass::MaxClassDepth)
+    {
+        Chain.Add(std::make_unique<UClass>(FName("DeepTestClass"), Super, nullptr));
+        Super = Chain.Last().get();
+    }
+
+    TEST_CHECK(Super->GetClassDepth() == UClass::MaxClassDepth - 1);
+    TEST_CHECK(Super->IsChildOf(UObject::GetStaticClass()));
+
+    bool bThrown = false;
+    try
+    {
+        UClass TooDeep(FName("TooDeepTestClass"), Super, nullptr);
+    }
+    catch (const std::length_error&)
+    {
+        bThrown = true;
+    }
+    TEST_CHECK(bThrown);
+}
@@ -0,0 +1,188 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Vertex.h"
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    void ReportArrayPair(const char* Name, const TPair<double, double>& Times)
+    {
+        const double VectorTime = Times.first;
+        const double ArrayTime = Times.second;
+        FBenchmark::Report("%-36s std::vector %9.1f us   TArray %9.1f us   (x%.2f)\n", Name, VectorTime, ArrayTime, VectorTime / ArrayTime);
+    }
+}
+
+// TArray vs std::vector - 재배치 가능 원소의 memcpy 이동, 인라인 할당자
+IMPLEMENT_BENCHMARK(TArrayVsVector)
+{
+    const int32 Count = 100000;
+    const int32 NumRuns = 7;
+    const FVertex Vertex{};
+
+    ReportArrayPair("push_back 100k FVertex", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<FVertex> Array; for (int32 i = 0; i < Count; ++i) Array.push_back(Vertex); FBenchmark::Consume(Array.back()); },
+        [&]() { TArray<FVertex> Array; for (int32 i = 0; i < Count; ++i) Array.push_back(Vertex); FBenchmark::Consume(Array.Last()); }));
+
+    // 위 항목은 큰 블록의 재할당(시스템 할당자의 페이지 매핑)에 좌우되므로 원소당 비용은 미리 확보한 경우로 본다
+    ReportArrayPair("push_back 100k FVertex (reserved)", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<FVertex> Array; Array.reserve(Count); for (int32 i = 0; i < Count; ++i) Array.push_back(Vertex); FBenchmark::Consume(Array.back()); },
+        [&]() { TArray<FVertex> Array; Array.Reserve(Count); for (int32 i = 0; i < Count; ++i) Array.push_back(Vertex); FBenchmark::Consume(Array.Last()); }));
+
+    const std::vector<FVertex> SourceVector(Count);
+    const TArray<FVertex> SourceArray(Count);
+    ReportArrayPair("copy 100k FVertex", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<FVertex> Array = SourceVector; FBenchmark::Consume(Array.back()); },
+        [&]() { TArray<FVertex> Array = SourceArray; FBenchmark::Consume(Array.Last()); }));
+
+    ReportArrayPair("push_back 100k pointers", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<void*> Array; for (int32 i = 0; i < Count; ++i) Array.push_back(nullptr); FBenchmark::Consume(Array.size()); },
+        [&]() { TArray<void*> Array; for (int32 i = 0; i < Count; ++i) Array.push_back(nullptr); FBenchmark::Consume(Array.Num()); }));
+
+    // 순서 유지 제거끼리 - 포인터는 양쪽 모두 memmove, 재배치할 수 없는 std::string은 양쪽 모두 이동 대입
+    ReportArrayPair("RemoveAt 10k from front of 20k", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<void*> Array(20000); for (int32 i = 0; i < 10000; ++i) Array.erase(Array.begin()); FBenchmark::Consume(Array.size()); },
+        [&]() { TArray<void*> Array(20000); for (int32 i = 0; i < 10000; ++i) Array.RemoveAt(0); FBenchmark::Consume(Array.Num()); }));
+
+    ReportArrayPair("RemoveAt 2k std::string from front", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<std::string> Array(4000); for (int32 i = 0; i < 2000; ++i) Array.erase(Array.begin()); FBenchmark::Consume(Array.size()); },
+        [&]() { TArray<std::string> Array(4000); for (int32 i = 0; i < 2000; ++i) Array.RemoveAt(0); FBenchmark::Consume(Array.Num()); }));
+
+    // 순서를 포기하는 제거끼리 - 표준 관용구(마지막 원소와 교환 후 pop_back)와 RemoveAtSwap
+    ReportArrayPair("RemoveAtSwap 10k from front of 20k", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<void*> Array(20000); for (int32 i = 0; i < 10000; ++i) { std::swap(Array.front(), Array.back()); Array.pop_back(); } FBenchmark::Consume(Array.size()); },
+        [&]() { TArray<void*> Array(20000); for (int32 i = 0; i < 10000; ++i) Array.RemoveAtSwap(0); FBenchmark::Consume(Array.Num()); }));
+
+    ReportArrayPair("8 pointers x 10k arrays (TInline<8>)", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { for (int32 k = 0; k < 10000; ++k) { std::vector<void*> Array; for (int32 i = 0; i < 8; ++i) Array.push_back(nullptr); FBenchmark::Consume(Array.size()); } },
+        [&]() { for (int32 k = 0; k < 10000; ++k) { TArray<void*, TInlineAllocator<8>> Array; for (int32 i = 0; i < 8; ++i) Array.push_back(nullptr); FBenchmark::Consume(Array.Num()); } }));
+
+    // 재배치 불가능한 원소는 이동 생성 + 소멸로 옮기므로 이득이 없어야 한다
+    ReportArrayPair("grow 20k std::string", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<std::string> Array; for (int32 i = 0; i < 20000; ++i) Array.emplace_back("abcdefghijklmnopqrstuvwxyz"); FBenchmark::Consume(Array.size()); },
+        [&]() { TArray<std::string> Array; for (int32 i = 0; i < 20000; ++i) Array.emplace_back("abcdefghijklmnopqrstuvwxyz"); FBenchmark::Consume(Array.Num()); }));
+
+    ReportArrayPair("grow 20k nested arrays", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { std::vector<std::vector<int32>> Array; for (int32 i = 0; i < 20000; ++i) Array.emplace_back(4, 0); FBenchmark::Consume(Array.size()); },
+        [&]() { TArray<TArray<int32>> Array; for (int32 i = 0; i < 20000; ++i) Array.emplace_back(4, 0); FBenchmark::Consume(Array.Num()); }));
+}
+
+namespace
+{
+    // 삽입 / 있는 키 찾기 / 없는 키 찾기 / 삭제의 키당 시간 (나노초)
+    template<typename MapType, typename KeyType>
+    void MeasureMapOperations(const std::vector<KeyType>& Keys, const std::vector<KeyType>& ShuffledKeys, const std::vector<KeyType>& MissingKeys, double (&Best)[ 4 ])
+    {
+        const double NumKeys = static_cast<double>(Keys.size());
+        int64 Sum = 0;
+        MapType Map;
+
+        double Start = FBenchmark::NowMicroseconds();
+        for (const KeyType& Key : Keys)
+        {
+            Map[ Key ] = 1;
+        }
+        double End = FBenchmark::NowMicroseconds();
+        Best[ 0 ] = std::min(Best[ 0 ], (End - Start) * 1000.0 / NumKeys);
+
+        Start = End;
+        for (const KeyType& Key : ShuffledKeys)
+        {
+            auto It = Map.find(Key);
+            if (It != Map.end())
+            {
+                Sum += It->second;
+            }
+        }
+        End = FBenchmark::NowMicroseconds();
+        Best[ 1 ] = std::min(Best[ 1 ], (End - Start) * 1000.0 / NumKeys);
+
+        Start = End;
+        for (const KeyType& Key : MissingKeys)
+        {
+            auto It = Map.find(Key);
+            if (It != Map.end())
+            {
+                Sum += It->second;
+            }
+        }
+        End = FBenchmark::NowMicroseconds();
+        Best[ 2 ] = std::min(Best[ 2 ], (End - Start) * 1000.0 / NumKeys);
+
+        Start = End;
+        for (const KeyType& Key : ShuffledKeys)
+        {
+            Map.erase(Key);
+        }
+        End = FBenchmark::NowMicroseconds();
+        Best[ 3 ] = std::min(Best[ 3 ], (End - Start) * 1000.0 / NumKeys);
+
+        FBenchmark::Consume(Sum);
+    }
+
+    template<typename KeyType, typename MakeKeyFunction>
+    void RunMapBenchmark(const char* KeyName, int32 NumKeys, MakeKeyFunction&& MakeKey)
+    {
+        std::vector<KeyType> Keys;
+        std::vector<KeyType> MissingKeys;
+        Keys.reserve(NumKeys);
+        MissingKeys.reserve(NumKeys);
+        for (int32 Index = 0; Index < NumKeys; ++Index)
+        {
+            Keys.push_back(MakeKey(Index));
+            MissingKeys.push_back(MakeKey(Index + NumKeys));
+        }
+
+        std::vector<KeyType> ShuffledKeys = Keys;
+        std::mt19937_64 Random(NumKeys);
+        std::shuffle(ShuffledKeys.begin(), ShuffledKeys.end(), Random);
+
+        // 작은 맵은 한 번이 너무 짧으므로 더 많이 반복한다
+        const int32 NumRuns = NumKeys <= 1000 ? 200 : (NumKeys <= 100000 ? 5 : 2);
+        double StdBest[ 4 ] = { 1e30, 1e30, 1e30, 1e30 };
+        double EngineBest[ 4 ] = { 1e30, 1e30, 1e30, 1e30 };
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            MeasureMapOperations<std::unordered_map<KeyType, int32>>(Keys, ShuffledKeys, MissingKeys, StdBest);
+            MeasureMapOperations<TMap<KeyType, int32>>(Keys, ShuffledKeys, MissingKeys, EngineBest);
+        }
+
+        const char* OperationNames[ 4 ] = { "insert", "find-hit", "find-miss", "erase" };
+        for (int32 Operation = 0; Operation < 4; ++Operation)
+        {
+            FBenchmark::Report("%-6s N=%-8d %-9s  unordered_map %7.1f ns   TMap %7.1f ns   (x%.2f)\n",
+                KeyName, NumKeys, OperationNames[ Operation ], StdBest[ Operation ], EngineBest[ Operation ], StdBest[ Operation ] / EngineBest[ Operation ]);
+        }
+    }
+}
+
+// TMap vs std::unordered_map - 평면 개방 주소법 해시 테이블
+IMPLEMENT_BENCHMARK(TMapVsUnorderedMap)
+{
+    const int32 Sizes[] = { 1000, 100000, 1000000 };
+
+    for (int32 NumKeys : Sizes)
+    {
+        RunMapBenchmark<uint64>("uint64", NumKeys, [](int32 Index)
+        {
+            // splitmix64 - 재현 가능한 무작위 키
+            uint64 Key = static_cast<uint64>(Index) * 0x9E3779B97F4A7C15ull;
+            Key = (Key ^ (Key >> 30)) * 0xBF58476D1CE4E5B9ull;
+            Key = (Key ^ (Key >> 27)) * 0x94D049BB133111EBull;
+            return Key ^ (Key >> 31);
+        });
+    }
+
+    for (int32 NumKeys : Sizes)
+    {
+        RunMapBenchmark<FName>("FName", NumKeys, [](int32 Index)
+        {
+            char Buffer[ 32 ];
+            snprintf(Buffer, sizeof(Buffer), "Obj_%d", Index);
+            return FName(Buffer);
+        });
+    }
+}
@@ -0,0 +1,69 @@
+#include "pch.h"
+#include "Delegate.h"
+
+FDelegateBroadcastQueue& FDelegateBroadcastQueue::Get()
+{
+    // 전역 델리게이트의 소멸자가 종료 시점에 Unregister할 수 있으므로 해제하지 않는다
+    static FDelegateBroadcastQueue* Instance = new FDelegateBroadcastQueue();
+    return *Instance;
+}
+
+void FDelegateBroadcastQueue::Register(void* Delegate, FDispatchFunction DispatchFunction)
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    PendingDelegates.push_back({ Delegate, DispatchFunction });
+}
+
+void FDelegateBroadcastQueue::Unregister(void* Delegate)
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+
+    PendingDelegates.RemoveAll([Delegate](const FPendingDelegate& Pending) { return Pending.Delegate == Delegate; });
+
+    // 디스패치 도중 리스너가 아직 호출되지 않은 델리게이트를 소멸시킨 경우
+    for (FPendingDelegate& Dispatching : DispatchingDelegates)
+    {
+        if (Dispatching.Delegate == Delegate)
+        {
+            Dispatching.Delegate = nullptr;
+        }
+    }
+}
+
+void FDelegateBroadcastQueue::Dispatch()
+{
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        if (PendingDelegates.empty())
+        {
+            return;
+        }
+        std::swap(PendingDelegates, DispatchingDelegates);
+    }
+
+    // 리스너가 새로 큐잉하면 PendingDelegates로 들어가 다음 Dispatch에서 처리된다
+    for (size_t i = 0; ; ++i)
+    {
+        FPendingDelegate Pending;
+        {
+            std::lock_guard<std::mutex> Lock(QueueMutex);
+            if (i >= DispatchingDelegates.size())
+            {
+                DispatchingDelegates.clear();
+                break;
+            }
+            Pending = DispatchingDelegates[ i ];
+        }
+
+        if (Pending.Delegate)
+        {
+            Pending.DispatchFunction(Pending.Delegate);
+        }
+    }
+}
+
+int32 FDelegateBroadcastQueue::GetNumPendingDelegates() const
+{
+    std::lock_guard<std::mutex> Lock(QueueMutex);
+    return static_cast<int32>(PendingDelegates.size());
+}
@@ -1,12 +1,317 @@
 #pragma once
-#include <functional>
-#include <vector>
+#include "Types.h"
+#include "Array.h"
+#include "Map.h"
+#include "Memory.h"
+#include "WeakObjectPtr.h"
+#include <algorithm>
+#include <atomic>
+#include <execution>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// 멀티캐스트 델리게이트에 추가된 바인딩 하나를 가리키는 핸들 (Remove에 사용)
+class FDelegateHandle
+{
+public:
+    FDelegateHandle() : ID(0) {}
+
+    bool IsValid() const { return ID != 0; }
+    void Reset() { ID = 0; }
+
+    bool operator==(const FDelegateHandle& Other) const { return ID == Other.ID; }
+    bool operator!=(const FDelegateHandle& Other) const { return ID != Other.ID; }
+
+    static FDelegateHandle Generate()
+    {
+        FDelegateHandle Handle;
+        Handle.ID = NextID.fetch_add(1, std::memory_order_relaxed);
+        return Handle;
+    }
+
+private:
+    uint64 ID;
+
+    static inline std::atomic<uint64> NextID{ 1 };
+};
+
+// 바인딩 대상들 - 오브젝트 + 멤버 함수 포인터를 그대로 저장한다
+template<typename T, typename Method>
+struct TRawMethodBinding
+{
+    T* Object;
+    Method Function;
+
+    template<typename... Args>
+    void operator()(Args&&... InArgs) const { (Object->*Function)(std::forward<Args>(InArgs)...); }
+
+    bool IsAlive() const { return true; }
+    const void* GetObject() const { return Object; }
+};
+
+// UObject 바인딩은 약한 참조(인덱스 + 시리얼)로 저장해 해제된 오브젝트를 호출하지 않는다
+template<typename T, typename Method>
+struct TUObjectMethodBinding
+{
+    TWeakObjectPtr<T> Object;
+    Method Function;
+
+    template<typename... Args>
+    void operator()(Args&&... InArgs) const
+    {
+        if (T* LiveObject = Object.Get())
+        {
+            (LiveObject->*Function)(std::forward<Args>(InArgs)...);
+        }
+    }
+
+    bool IsAlive() const { return Object.IsValid(); }
+    const void* GetObject() const { return Object.Get(true); }
+};
+
+// 바인딩 하나 - 호출 대상을 인라인 버퍼에 직접 저장하고 타입별 함수 포인터 테이블로 호출한다
+// 오브젝트 + 멤버 함수 포인터 바인딩은 항상 인라인에 들어가며, 버퍼보다 큰 람다만 바인딩할 때 힙에 둔다.
+template<typename... Args>
+class TDelegateInstance
+{
+public:
+    static constexpr size_t InlineSize = 32;
+
+    TDelegateInstance() : Ops(nullptr), ExecuteFunction(nullptr) {}
+    ~TDelegateInstance() { Unbind(); }
+
+    TDelegateInstance(const TDelegateInstance& Other) : Ops(nullptr), ExecuteFunction(nullptr) { CopyFrom(Other); }
+    TDelegateInstance(TDelegateInstance&& Other) noexcept : Ops(nullptr), ExecuteFunction(nullptr) { MoveFrom(Other); }
+
+    TDelegateInstance& operator=(const TDelegateInstance& Other)
+    {
+        if (this != &Other)
+        {
+            Unbind();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TDelegateInstance& operator=(TDelegateInstance&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Unbind();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    template<typename FunctorType>
+    void Bind(FunctorType&& Functor)
+    {
+        using FStored = std::decay_t<FunctorType>;
+
+        Unbind();
+        if constexpr (TFitsInline<FStored>::Value)
+        {
+            new (Storage) FStored(std::forward<FunctorType>(Functor));
+            Ops = &TInlineOps<FStored>::Table;
+            ExecuteFunction = Ops->Execute;
+        }
+        else
+        {
+            void* Memory = FMemory::Malloc(sizeof(FStored), alignof(FStored) > FMemory::DEFAULT_ALIGNMENT ? alignof(FStored) : FMemory::DEFAULT_ALIGNMENT);
+            if (!Memory)
+            {
+                throw std::bad_alloc();
+            }
+            new (Memory) FStored(std::forward<FunctorType>(Functor));
+            *reinterpret_cast<void**>(Storage) = Memory;
+            Ops = &THeapOps<FStored>::Table;
+            ExecuteFunction = Ops->Execute;
+        }
+    }
+
+    void Unbind()
+    {
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+            ExecuteFunction = nullptr;
+        }
+    }
+
+    bool IsBound() const { return Ops != nullptr; }
+
+    // Raw/람다 바인딩은 생존 검사 없이 바로 호출해도 된다
+    bool CanExpire() const { return Ops && Ops->bCanExpire; }
+
+    // 바인딩된 UObject가 해제되었거나 PendingKill이면 false
+    bool IsSafeToExecute() const { return Ops && Ops->IsAlive(Storage); }
+
+    bool IsBoundToObject(const void* Object) const { return Ops && Object && Ops->GetObject(Storage) == Object; }
+
+    void Execute(Args... InArgs) const
+    {
+        ExecuteFunction(const_cast<uint8*>(Storage), InArgs...);
+    }
+
+    // 살아 있으면 호출하고 true, 대상 UObject가 해제되었으면 호출하지 않고 false (간접 호출 한 번)
+    bool ExecuteIfSafe(Args... InArgs) const
+    {
+        return Ops->ExecuteIfSafe(const_cast<uint8*>(Storage), InArgs...);
+    }
+
+private:
+    struct FOps
+    {
+        void (*Execute)(void* Storage, Args... InArgs);
+        bool (*ExecuteIfSafe)(void* Storage, Args... InArgs);
+        bool (*IsAlive)(const void* Storage);
+        const void* (*GetObject)(const void* Storage);
+        void (*CopyConstruct)(void* Dest, const void* Source);
+        void (*MoveConstruct)(void* Dest, void* Source);
+        void (*Destroy)(void* Storage);
+        bool bCanExpire;    // UObject 바인딩처럼 대상이 먼저 사라질 수 있는 경우
+    };
+
+    template<typename FunctorType>
+    struct TFitsInline
+    {
+        static constexpr bool Value = sizeof(FunctorType) <= InlineSize
+            && alignof(FunctorType) <= alignof(void*)
+            && std::is_nothrow_move_constructible_v<FunctorType>;
+    };
+
+    template<typename FunctorType>
+    struct TCanExpire
+    {
+        static constexpr bool Value = requires(const FunctorType& Functor) { Functor.IsAlive(); };
+    };
+
+    template<typename FunctorType>
+    static bool IsFunctorAlive(const FunctorType& Functor)
+    {
+        if constexpr (TCanExpire<FunctorType>::Value)
+        {
+            return Functor.IsAlive();
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template<typename FunctorType>
+    static bool ExecuteFunctorIfSafe(FunctorType& Functor, Args... InArgs)
+    {
+        if (!IsFunctorAlive(Functor))
+        {
+            return false;
+        }
+        Functor(InArgs...);
+        return true;
+    }
+
+    template<typename FunctorType>
+    static const void* GetFunctorObject(const FunctorType& Functor)
+    {
+        if constexpr (requires { Functor.GetObject(); })
+        {
+            return Functor.GetObject();
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    template<typename FunctorType>
+    struct TInlineOps
+    {
+        static FunctorType& Get(void* Storage) { return *static_cast<FunctorType*>(Storage); }
+        static const FunctorType& Get(const void* Storage) { return *static_cast<const FunctorType*>(Storage); }
+
+        static constexpr FOps Table =
+        {
+            [](void* Storage, Args... InArgs) { Get(Storage)(InArgs...); },
+            [](void* Storage, Args... InArgs) { return ExecuteFunctorIfSafe(Get(Storage), InArgs...); },
+            [](const void* Storage) { return IsFunctorAlive(Get(Storage)); },
+            [](const void* Storage) { return GetFunctorObject(Get(Storage)); },
+            [](void* Dest, const void* Source) { new (Dest) FunctorType(Get(Source)); },
+            [](void* Dest, void* Source) { new (Dest) FunctorType(std::move(Get(Source))); Get(Source).~FunctorType(); },
+            [](void* Storage) { Get(Storage).~FunctorType(); },
+            TCanExpire<FunctorType>::Value,
+        };
+    };
+
+    template<typename FunctorType>
+    struct THeapOps
+    {
+        static FunctorType& Get(void* Storage) { return **static_cast<FunctorType**>(Storage); }
+        static const FunctorType& Get(const void* Storage) { return **static_cast<FunctorType* const*>(Storage); }
+
+        static constexpr FOps Table =
+        {
+            [](void* Storage, Args... InArgs) { Get(Storage)(InArgs...); },
+            [](void* Storage, Args... InArgs) { return ExecuteFunctorIfSafe(Get(Storage), InArgs...); },
+            [](const void* Storage) { return IsFunctorAlive(Get(Storage)); },
+            [](const void* Storage) { return GetFunctorObject(Get(Storage)); },
+            [](void* Dest, const void* Source)
+            {
+                void* Memory = FMemory::Malloc(sizeof(FunctorType), alignof(FunctorType) > FMemory::DEFAULT_ALIGNMENT ? alignof(FunctorType) : FMemory::DEFAULT_ALIGNMENT);
+                if (!Memory)
+                {
+                    throw std::bad_alloc();
+                }
+                new (Memory) FunctorType(Get(Source));
+                *static_cast<void**>(Dest) = Memory;
+            },
+            [](void* Dest, void* Source) { *static_cast<void**>(Dest) = *static_cast<void**>(Source); },
+            [](void* Storage)
+            {
+                FunctorType* Functor = *static_cast<FunctorType**>(Storage);
+                Functor->~FunctorType();
+                FMemory::Free(Functor);
+            },
+            TCanExpire<FunctorType>::Value,
+        };
+    };
+
+    void CopyFrom(const TDelegateInstance& Other)
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->CopyConstruct(Storage, Other.Storage);
+            Ops = Other.Ops;
+            ExecuteFunction = Other.ExecuteFunction;
+        }
+    }
+
+    void MoveFrom(TDelegateInstance& Other)
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->MoveConstruct(Storage, Other.Storage);
+            Ops = Other.Ops;
+            ExecuteFunction = Other.ExecuteFunction;
+            Other.Ops = nullptr;
+            Other.ExecuteFunction = nullptr;
+        }
+    }
+
+    alignas(void*) uint8 Storage[ InlineSize ];
+    const FOps* Ops;
+    void (*ExecuteFunction)(void* Storage, Args... InArgs);    // 호출 경로에서 테이블을 한 번 덜 읽도록 따로 보관
+};
 
 template<typename... Args>
 class TDelegate
 {
 private:
-    std::function<void(Args...)> Function;
+    TDelegateInstance<Args...> Instance;
 
 public:
     TDelegate() = default;
@@ -14,110 +319,426 @@ public:
     template<typename T>
     void BindLambda(T&& Lambda)
     {
-        Function = std::forward<T>(Lambda);
+        Instance.Bind(std::forward<T>(Lambda));
     }
 
     template<typename T, typename Method>
     void BindRaw(T* Object, Method&& method)
     {
-        Function = [Object, method](Args... args) {
-            (Object->*method)(args...);
-        };
+        Instance.Bind(TRawMethodBinding<T, std::decay_t<Method>>{ Object, method });
     }
 
+    // 오브젝트가 해제된 뒤에도 안전하도록 약한 참조로 저장
     template<typename T, typename Method>
     void BindUObject(T* Object, Method&& method)
     {
-        Function = [Object, method](Args... args) {
-            if (Object && Object->IsValid())
-            {
-                (Object->*method)(args...);
-            }
-        };
+        Instance.Bind(TUObjectMethodBinding<T, std::decay_t<Method>>{ TWeakObjectPtr<T>(Object), method });
     }
 
     void Execute(Args... args)
     {
-        if (Function)
-        {
-            Function(args...);
-        }
+        ExecuteIfBound(args...);
     }
 
-    void ExecuteIfBound(Args... args)
+    bool ExecuteIfBound(Args... args)
     {
-        Execute(args...);
+        return Instance.IsBound() && Instance.ExecuteIfSafe(args...);
     }
 
     bool IsBound() const
     {
-        return static_cast<bool>(Function);
+        return Instance.IsSafeToExecute();
+    }
+
+    bool IsBoundToObject(const void* Object) const
+    {
+        return Instance.IsBoundToObject(Object);
     }
 
     void Unbind()
     {
-        Function = nullptr;
+        Instance.Unbind();
     }
 };
 
+// 큐잉된 멀티캐스트 브로드캐스트를 프레임의 정해진 지점(UWorld::Tick)에서 한꺼번에 디스패치한다
+// 델리게이트는 한 프레임에 처음 QueueBroadcast될 때 한 번만 등록되며, 디스패치 중 새로 큐잉된 이벤트는 다음 Dispatch로 넘어간다.
+class FDelegateBroadcastQueue
+{
+public:
+    using FDispatchFunction = void (*)(void* Delegate);
+
+    static FDelegateBroadcastQueue& Get();
+
+    void Register(void* Delegate, FDispatchFunction DispatchFunction);
+
+    // 대기 중인 델리게이트가 소멸될 때 호출
+    void Unregister(void* Delegate);
+
+    void Dispatch();
+
+    int32 GetNumPendingDelegates() const;
+
+private:
+    struct FPendingDelegate
+    {
+        void* Delegate;
+        FDispatchFunction DispatchFunction;
+    };
+
+    TArray<FPendingDelegate> PendingDelegates;
+    TArray<FPendingDelegate> DispatchingDelegates;
+    mutable std::mutex QueueMutex;
+};
+
+// 여러 바인딩을 한 번에 호출하는 델리게이트
+// - Broadcast 중에 Remove/Clear된 바인딩은 즉시 호출 대상에서 빠지고, 실제 정리는 가장 바깥 Broadcast가 끝난 뒤에 한다.
+// - Broadcast 중에 Add된 바인딩은 이번 Broadcast에서는 호출되지 않는다.
+// - 해제된 UObject에 대한 바인딩은 Broadcast에서 발견되는 대로 제거 표시 후 한꺼번에 압축한다.
+// - QueueBroadcast는 키별로 합쳐져(마지막 인자 유지) FDelegateBroadcastQueue::Dispatch에서 프레임당 한 번 호출된다.
 template<typename... Args>
 class TMulticastDelegate
 {
+public:
+    // 큐잉된 이벤트가 이 수 이상이면 스레드 안전 바인딩을 병렬로 호출
+    static constexpr size_t ParallelDispatchThreshold = 64;
+
 private:
-    std::vector<std::function<void(Args...)>> Functions;
+    // 한 바인딩이 캐시 라인 하나에 들어가도록 정렬 (Broadcast는 배열을 순서대로 훑는다)
+    struct alignas(64) FBinding
+    {
+        TDelegateInstance<Args...> Instance;
+        FDelegateHandle Handle;
+        bool bRemoved = false;
+        bool bNeedsCheck = false;   // 제거되었거나 UObject 바인딩이라 호출 전에 검사가 필요 (Raw/람다는 바로 호출)
+        bool bThreadSafe = false;   // 큐 디스패치 시 워커 스레드에서 호출해도 되는 바인딩
+    };
+
+    // 키로 합쳐진 큐잉 이벤트 - 처음 QueueBroadcast할 때 생성하고 버퍼는 프레임마다 비워서 재사용한다
+    struct FQueuedBroadcasts
+    {
+        using FPayload = std::tuple<std::decay_t<Args>...>;
+
+        TArray<FPayload> Payloads;
+        TArray<FPayload> DispatchingPayloads;
+        TMap<uint64, int32> KeyToIndex;
+        bool bRegistered = false;
+    };
+
+    TArray<FBinding> Bindings;
+    TArray<FBinding> PendingBindings;   // Broadcast 중에 추가된 바인딩
+    std::unique_ptr<FQueuedBroadcasts> Queued;
+    int32 BroadcastDepth = 0;
+    bool bNeedsCompaction = false;
+
+    template<typename FunctorType>
+    FDelegateHandle AddBinding(FunctorType&& Functor, bool bThreadSafe = false)
+    {
+        // 배열이 재배치되면 실행 중인 바인딩이 옮겨지므로 Broadcast 중에는 따로 모아 둔다
+        TArray<FBinding>& Target = BroadcastDepth > 0 ? PendingBindings : Bindings;
+
+        Target.emplace_back();
+        FBinding& Binding = Target.back();
+        Binding.Instance.Bind(std::forward<FunctorType>(Functor));
+        Binding.bNeedsCheck = Binding.Instance.CanExpire();
+        Binding.bThreadSafe = bThreadSafe;
+        Binding.Handle = FDelegateHandle::Generate();
+        return Binding.Handle;
+    }
+
+    // bSkipThreadSafe이면 병렬 단계에서 이미 호출한 스레드 안전 바인딩을 건너뛴다
+    template<bool bSkipThreadSafe>
+    void BroadcastInternal(Args... args)
+    {
+        ++BroadcastDepth;
+
+        const size_t NumBindings = Bindings.size();
+        for (size_t i = 0; i < NumBindings; ++i)
+        {
+            FBinding& Binding = Bindings[ i ];
+            if constexpr (bSkipThreadSafe)
+            {
+                if (Binding.bThreadSafe)
+                {
+                    continue;
+                }
+            }
+
+            // 대부분인 Raw/람다 바인딩은 플래그 하나만 보고 바로 호출
+            if (!Binding.bNeedsCheck)
+            {
+                Binding.Instance.Execute(args...);
+                continue;
+            }
+
+            if (!Binding.bRemoved && !Binding.Instance.ExecuteIfSafe(args...))
+            {
+                MarkRemoved(Binding);
+            }
+        }
+
+        --BroadcastDepth;
+        CompactIfPossible();
+    }
+
+    static void DispatchQueuedBroadcastsThunk(void* Delegate)
+    {
+        static_cast<TMulticastDelegate*>(Delegate)->DispatchQueuedBroadcasts();
+    }
+
+    void DispatchQueuedBroadcasts()
+    {
+        FQueuedBroadcasts& Queue = *Queued;
+        Queue.bRegistered = false;
+
+        // 리스너가 다시 큐잉하면 다음 프레임 버퍼로 들어가도록 먼저 교체
+        std::swap(Queue.Payloads, Queue.DispatchingPayloads);
+        Queue.KeyToIndex.clear();
+
+        TArray<typename FQueuedBroadcasts::FPayload>& Payloads = Queue.DispatchingPayloads;
+
+        const bool bHasThreadSafeBindings = std::any_of(Bindings.begin(), Bindings.end(),
+            [](const FBinding& Binding) { return Binding.bThreadSafe && !Binding.bRemoved; });
+
+        ++BroadcastDepth;
+        if (bHasThreadSafeBindings && Payloads.size() >= ParallelDispatchThreshold)
+        {
+            // 스레드 안전 바인딩은 이벤트 단위로 병렬 호출 (이 단계에서 델리게이트를 수정하면 안 된다)
+            std::for_each(std::execution::par, Payloads.begin(), Payloads.end(), [this](auto& Payload)
+            {
+                std::apply([this](auto&... Params)
+                {
+                    for (FBinding& Binding : Bindings)
+                    {
+                        if (Binding.bThreadSafe && !Binding.bRemoved)
+                        {
+                            Binding.Instance.Execute(Params...);
+                        }
+                    }
+                }, Payload);
+            });
+
+            for (auto& Payload : Payloads)
+            {
+                std::apply([this](auto&... Params) { BroadcastInternal<true>(Params...); }, Payload);
+            }
+        }
+        else
+        {
+            for (auto& Payload : Payloads)
+            {
+                std::apply([this](auto&... Params) { BroadcastInternal<false>(Params...); }, Payload);
+            }
+        }
+        --BroadcastDepth;
+
+        Payloads.clear();
+        CompactIfPossible();
+    }
+
+    void MarkRemoved(FBinding& Binding)
+    {
+        Binding.bRemoved = true;
+        Binding.bNeedsCheck = true;
+        bNeedsCompaction = true;
+    }
+
+    void CompactIfPossible()
+    {
+        if (BroadcastDepth > 0)
+        {
+            return;
+        }
+
+        if (bNeedsCompaction)
+        {
+            Bindings.RemoveAll([](const FBinding& Binding) { return Binding.bRemoved; });
+            bNeedsCompaction = false;
+        }
+
+        if (!PendingBindings.empty())
+        {
+            for (FBinding& Binding : PendingBindings)
+            {
+                if (!Binding.bRemoved)
+                {
+                    Bindings.push_back(std::move(Binding));
+                }
+            }
+            PendingBindings.clear();
+        }
+    }
+
+    template<typename FunctionType>
+    void ForEachBinding(FunctionType&& Function)
+    {
+        for (FBinding& Binding : Bindings)
+        {
+            Function(Binding);
+        }
+        for (FBinding& Binding : PendingBindings)
+        {
+            Function(Binding);
+        }
+    }
 
 public:
     TMulticastDelegate() = default;
 
+    // 큐에 등록된 주소가 바뀌지 않도록 복사/이동하지 않는다
+    TMulticastDelegate(const TMulticastDelegate&) = delete;
+    TMulticastDelegate& operator=(const TMulticastDelegate&) = delete;
+
+    ~TMulticastDelegate()
+    {
+        if (Queued && Queued->bRegistered)
+        {
+            FDelegateBroadcastQueue::Get().Unregister(this);
+        }
+    }
+
     template<typename T>
-    void AddLambda(T&& Lambda)
+    FDelegateHandle AddLambda(T&& Lambda)
     {
-        Functions.emplace_back(std::forward<T>(Lambda));
+        return AddBinding(std::forward<T>(Lambda));
     }
 
     template<typename T, typename Method>
-    void AddRaw(T* Object, Method&& method)
+    FDelegateHandle AddRaw(T* Object, Method&& method)
     {
-        Functions.emplace_back([Object, method](Args... args) {
-            (Object->*method)(args...);
-        });
+        return AddBinding(TRawMethodBinding<T, std::decay_t<Method>>{ Object, method });
+    }
+
+    template<typename T, typename Method>
+    FDelegateHandle AddUObject(T* Object, Method&& method)
+    {
+        return AddBinding(TUObjectMethodBinding<T, std::decay_t<Method>>{ TWeakObjectPtr<T>(Object), method });
+    }
+
+    // 큐 디스패치 때 워커 스레드에서 호출될 수 있는 바인딩 - 공유 상태를 건드리지 않는 리스너에만 사용
+    template<typename T>
+    FDelegateHandle AddThreadSafeLambda(T&& Lambda)
+    {
+        return AddBinding(std::forward<T>(Lambda), true);
     }
 
     template<typename T, typename Method>
-    void AddUObject(T* Object, Method&& method)
+    FDelegateHandle AddThreadSafeRaw(T* Object, Method&& method)
+    {
+        return AddBinding(TRawMethodBinding<T, std::decay_t<Method>>{ Object, method }, true);
+    }
+
+    bool Remove(FDelegateHandle Handle)
     {
-        Functions.emplace_back([Object, method](Args... args) {
-            if (Object && Object->IsValid())
+        bool bFound = false;
+        ForEachBinding([&](FBinding& Binding)
+        {
+            if (!bFound && !Binding.bRemoved && Binding.Handle == Handle)
             {
-                (Object->*method)(args...);
+                MarkRemoved(Binding);
+                bFound = true;
             }
         });
+
+        CompactIfPossible();
+        return bFound;
     }
 
-    void Broadcast(Args... args)
+    // Object에 바인딩된 모든 Raw/UObject 바인딩 제거
+    int32 RemoveAll(const void* Object)
     {
-        for (auto& Function : Functions)
+        int32 NumRemoved = 0;
+        ForEachBinding([&](FBinding& Binding)
         {
-            if (Function)
+            if (!Binding.bRemoved && Binding.Instance.IsBoundToObject(Object))
             {
-                Function(args...);
+                MarkRemoved(Binding);
+                ++NumRemoved;
             }
+        });
+
+        CompactIfPossible();
+        return NumRemoved;
+    }
+
+    // 할당 없이 현재 바인딩들을 순서대로 호출
+    void Broadcast(Args... args)
+    {
+        BroadcastInternal<false>(args...);
+    }
+
+    // 이번 프레임의 디스패치 때 한 번 호출되도록 큐잉 - 여러 번 호출해도 마지막 인자로 한 번만 호출된다
+    void QueueBroadcast(Args... args)
+    {
+        QueueBroadcastCoalesced(0, args...);
+    }
+
+    // 같은 키의 이벤트는 합쳐져 마지막 인자로 한 번만 호출된다 (예: 오브젝트별 키로 변경 알림을 프레임당 한 번으로)
+    // 게임 스레드에서만 호출한다.
+    void QueueBroadcastCoalesced(uint64 Key, Args... args)
+    {
+        if (Bindings.empty() && PendingBindings.empty())
+        {
+            return;
+        }
+
+        if (!Queued)
+        {
+            Queued = std::make_unique<FQueuedBroadcasts>();
         }
+
+        auto [It, bInserted] = Queued->KeyToIndex.try_emplace(Key, static_cast<int32>(Queued->Payloads.size()));
+        if (bInserted)
+        {
+            Queued->Payloads.emplace_back(args...);
+        }
+        else
+        {
+            Queued->Payloads[ It->second ] = typename FQueuedBroadcasts::FPayload(args...);
+        }
+
+        if (!Queued->bRegistered)
+        {
+            Queued->bRegistered = true;
+            FDelegateBroadcastQueue::Get().Register(this, &DispatchQueuedBroadcastsThunk);
+        }
+    }
+
+    size_t GetNumQueuedBroadcasts() const
+    {
+        return Queued ? Queued->Payloads.size() : 0;
     }
 
     void Clear()
     {
-        Functions.clear();
+        if (BroadcastDepth > 0)
+        {
+            ForEachBinding([this](FBinding& Binding) { MarkRemoved(Binding); });
+            return;
+        }
+
+        Bindings.clear();
+        PendingBindings.clear();
+        bNeedsCompaction = false;
     }
 
     bool IsBound() const
     {
-        return !Functions.empty();
+        return GetBoundFunctionCount() > 0;
     }
 
     size_t GetBoundFunctionCount() const
     {
-        return Functions.size();
+        size_t Count = 0;
+        for (const FBinding& Binding : Bindings)
+        {
+            Count += (!Binding.bRemoved && Binding.Instance.IsSafeToExecute()) ? 1 : 0;
+        }
+        for (const FBinding& Binding : PendingBindings)
+        {
+            Count += (!Binding.bRemoved && Binding.Instance.IsSafeToExecute()) ? 1 : 0;
+        }
+        return Count;
     }
 };
 
@@ -0,0 +1,27 @@
+#include "pch.h"
+#include "GarbageCollection.h"
+#include "Object.h"
+#include "UObjectArray.h"
+
+void FReferenceCollector::AddReferencedObject(UObject* Object)
+{
+    if (!Object || Object->IsPendingKill())
+    {
+        return;
+    }
+
+    const int32 Index = Object->GetInternalIndex();
+    FUObjectItem* Item = GUObjectArray.GetObjectItemPtr(Index);
+    if (!Item || Item->Object != Object || Item->HasAnyFlags(EInternalObjectFlags::Reachable))
+    {
+        return;
+    }
+
+    if (bYoungOnly && !Item->HasAnyFlags(EInternalObjectFlags::Young))
+    {
+        return;
+    }
+
+    Item->SetFlags(EInternalObjectFlags::Reachable);
+    ObjectsToVisit.push_back(Index);
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include "Types.h"
+#include "Array.h"
+
+class UObject;
+template<typename T> class TObjectPtr;
+
+// GC 진행 단계 (증분 메이저 GC)
+enum class EGarbageCollectionPhase : uint8
+{
+    Idle,
+    MarkingRoots,   // 루트 셋 스캔
+    Marking,        // 회색 스택 처리
+    Sweeping,       // 도달 불가 오브젝트 수집 + BeginDestroy
+    Purging,        // 수집된 오브젝트 삭제
+};
+
+enum class EGarbageCollectionType : uint8
+{
+    Full,           // 한 번에 끝까지 수행 (PerformGarbageCollector)
+    Incremental,    // 프레임마다 예산만큼 나눠서 수행
+    Young,          // 새로 생성된 오브젝트만 대상으로 하는 마이너 GC
+};
+
+// 한 번의 GC 결과
+struct FGarbageCollectionStats
+{
+    EGarbageCollectionType Type;
+    int32 NumObjects;       // 검사한 오브젝트 수 (마이너 GC는 젊은 오브젝트 수)
+    int32 NumReachable;     // 도달 가능한 것으로 확인된 오브젝트 수
+    int32 NumCollected;     // 해제된 오브젝트 수
+    int32 NumSteps;         // 나눠서 수행된 단계 수
+    double MarkTimeMs;
+    double SweepTimeMs;
+    double PauseTimeMs;     // 모든 단계의 정지 시간 합
+    double MaxPauseTimeMs;  // 가장 긴 단일 정지 시간
+
+    FGarbageCollectionStats()
+        : Type(EGarbageCollectionType::Full)
+        , NumObjects(0)
+        , NumReachable(0)
+        , NumCollected(0)
+        , NumSteps(0)
+        , MarkTimeMs(0.0)
+        , SweepTimeMs(0.0)
+        , PauseTimeMs(0.0)
+        , MaxPauseTimeMs(0.0)
+    {
+    }
+};
+
+// 예산/주기 튜닝 값
+struct FGarbageCollectionSettings
+{
+    double TimeBudgetMicroseconds;      // UWorld::Tick 한 번에 쓸 수 있는 GC 시간
+    int32 YoungGenerationThreshold;     // 젊은 오브젝트가 이만큼 쌓이면 마이너 GC
+    float MajorCollectionInterval;      // 메이저 GC 시작 간격 (초)
+
+    FGarbageCollectionSettings()
+        : TimeBudgetMicroseconds(1000.0)
+        , YoungGenerationThreshold(4096)
+        , MajorCollectionInterval(60.0f)
+    {
+    }
+};
+
+// GC 정지 시간 분포
+struct FGarbageCollectionPauseHistogram
+{
+    static constexpr int32 NumBuckets = 10;
+
+    // 각 버킷의 상한 (마이크로초), 마지막 버킷은 그 이상 전부
+    static constexpr double BucketLimitsMicroseconds[ NumBuckets - 1 ] = { 50.0, 100.0, 250.0, 500.0, 1000.0, 2000.0, 4000.0, 8000.0, 16000.0 };
+
+    uint32 Counts[ NumBuckets ];
+    uint32 NumPauses;
+    double TotalPauseMicroseconds;
+    double MaxPauseMicroseconds;
+
+    FGarbageCollectionPauseHistogram() { Reset(); }
+
+    void AddPause(double Microseconds)
+    {
+        int32 Bucket = 0;
+        while (Bucket < NumBuckets - 1 && Microseconds >= BucketLimitsMicroseconds[ Bucket ])
+        {
+            ++Bucket;
+        }
+
+        ++Counts[ Bucket ];
+        ++NumPauses;
+        TotalPauseMicroseconds += Microseconds;
+        MaxPauseMicroseconds = std::max(MaxPauseMicroseconds, Microseconds);
+    }
+
+    void Reset()
+    {
+        for (uint32& Count : Counts)
+        {
+            Count = 0;
+        }
+        NumPauses = 0;
+        TotalPauseMicroseconds = 0.0;
+        MaxPauseMicroseconds = 0.0;
+    }
+};
+
+// GC 마킹 단계에서 오브젝트가 참조하는 다른 오브젝트를 보고받는 수집기
+// UObject::AddReferencedObjects 구현에서 사용한다.
+class FReferenceCollector
+{
+public:
+    // 방문할 오브젝트의 GUObjectArray 인덱스 스택 (증분 GC에서는 프레임을 넘어 유지된다)
+    using FObjectStack = TArray<int32>;
+
+    FReferenceCollector(FObjectStack& InObjectsToVisit, bool bInYoungOnly)
+        : ObjectsToVisit(InObjectsToVisit)
+        , bYoungOnly(bInYoungOnly)
+    {
+    }
+
+    // 아직 마킹되지 않았고 PendingKill이 아니면 마킹하고 방문 목록에 추가
+    // 마이너 GC에서는 오래된 오브젝트는 살아 있다고 보고 따라가지 않는다.
+    void AddReferencedObject(UObject* Object);
+
+    template<typename T, typename AllocatorType>
+    void AddReferencedObjects(const TArray<T*, AllocatorType>& Objects)
+    {
+        for (T* Object : Objects)
+        {
+            AddReferencedObject(Object);
+        }
+    }
+
+    // TObjectPtr 필드 - 직접 delete된 오브젝트는 nullptr로 풀리므로 해제된 메모리를 따라가지 않는다
+    template<typename T>
+    void AddReferencedObject(const TObjectPtr<T>& Object)
+    {
+        AddReferencedObject(Object.Get());
+    }
+
+    template<typename T, typename AllocatorType>
+    void AddReferencedObjects(const TArray<TObjectPtr<T>, AllocatorType>& Objects)
+    {
+        for (const TObjectPtr<T>& Object : Objects)
+        {
+            AddReferencedObject(Object.Get());
+        }
+    }
+
+private:
+    FObjectStack& ObjectsToVisit;
+    bool bYoungOnly;
+};
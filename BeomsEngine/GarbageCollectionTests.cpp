@@ -0,0 +1,107 @@
+#include "pch.h"
+#include "AutomationTest.h"
+#include "Level.h"
+#include "ObjectInitializer.h"
+#include "StaticMesh.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+
+namespace
+{
+    // 진행 중인 사이클을 끝낸 뒤 마이너 GC 한 번, 정지형 메이저 GC 한 번
+    void CollectYoungThenFull()
+    {
+        GUObjectArray.PerformGarbageCollector();
+        GUObjectArray.CollectYoungGeneration();
+        GUObjectArray.PerformGarbageCollector();
+    }
+
+    void CollectYoungOnly()
+    {
+        if (GUObjectArray.IsGarbageCollecting())
+        {
+            GUObjectArray.PerformGarbageCollector();
+        }
+        GUObjectArray.CollectYoungGeneration();
+    }
+}
+
+// GC 밖의 코드만 쥐고 있는 최상위 오브젝트는 마이너/메이저 GC를 모두 통과하고, PendingKill이 되어야 해제된다
+IMPLEMENT_TEST(GarbageCollection_ExternallyHeldTopLevelObject)
+{
+    UObject* Object = NewObject<UObject>();
+    UObject* Child = NewObject<UObject>(Object);
+    TWeakObjectPtr<UObject> WeakObject(Object);
+    TWeakObjectPtr<UObject> WeakChild(Child);
+
+    CollectYoungOnly();
+    TEST_CHECK(WeakObject.Get() == Object);
+
+    CollectYoungThenFull();
+    TEST_CHECK(WeakObject.Get() == Object);
+
+    // 최상위 오브젝트가 죽으면 그 오브젝트로만 도달하던 자식도 함께 해제된다
+    Object->MarkPendingKill();
+    GUObjectArray.PerformGarbageCollector();
+    TEST_CHECK(WeakObject.IsStale());
+    TEST_CHECK(WeakChild.IsStale());
+}
+
+// 팩토리가 돌려준 액터 - Outer도 레벨도 없고 호출한 쪽의 포인터로만 유지된다
+IMPLEMENT_TEST(GarbageCollection_FactoryActorSurvives)
+{
+    AStaticMeshActor* Actor = AStaticMeshActor::CreateWithCubeMesh();
+    TWeakObjectPtr<AStaticMeshActor> WeakActor(Actor);
+    TWeakObjectPtr<UStaticMeshComponent> WeakComponent(Actor->GetStaticMeshComponent());
+    TWeakObjectPtr<UStaticMesh> WeakMesh(Actor->GetStaticMesh());
+
+    CollectYoungOnly();
+    CollectYoungThenFull();
+
+    TEST_CHECK(WeakActor.Get() == Actor);
+    TEST_CHECK(WeakComponent.IsValid());
+    TEST_CHECK(WeakMesh.IsValid());
+    TEST_CHECK(Actor->GetStaticMesh() == WeakMesh.Get());
+
+    UStaticMesh* Mesh = Actor->GetStaticMesh();
+    Actor->MarkPendingKill();
+    Mesh->MarkPendingKill();
+    GUObjectArray.PerformGarbageCollector();
+    TEST_CHECK(WeakActor.IsStale());
+    TEST_CHECK(WeakComponent.IsStale());
+    TEST_CHECK(WeakMesh.IsStale());
+}
+
+// 레벨의 TObjectPtr 배열로만 도달하는 액터 - 오래된 레벨이 젊은 액터를 가리켜도 마이너 GC를 통과한다
+IMPLEMENT_TEST(GarbageCollection_ObjectPtrKeepsActorAlive)
+{
+    ULevel* Level = NewObject<ULevel>();
+    CollectYoungThenFull();
+
+    // Outer 참조는 액터 -> 레벨 방향이므로 레벨 -> 액터 경로는 Actors뿐이다
+    AActor* Actor = NewObject<AActor>(Level);
+    AActor* Deleted = NewObject<AActor>(Level);
+    Level->AddActor(Actor);
+    Level->AddActor(Deleted);
+    TWeakObjectPtr<AActor> WeakActor(Actor);
+
+    CollectYoungOnly();
+    TEST_CHECK(WeakActor.Get() == Actor);
+
+    CollectYoungThenFull();
+    TEST_CHECK(WeakActor.Get() == Actor);
+
+    // 레벨을 거치지 않고 지운 액터는 dangling 포인터 대신 nullptr로 풀리고, GC도 그 슬롯을 따라가지 않는다
+    delete Deleted;
+    TEST_CHECK(Level->GetActors()[ 1 ] == nullptr);
+    TEST_CHECK(Level->GetActors()[ 1 ].IsStale());
+    CollectYoungThenFull();
+    TEST_CHECK(WeakActor.Get() == Actor);
+
+    Level->RemoveActor(Actor);
+    GUObjectArray.PerformGarbageCollector();
+    TEST_CHECK(WeakActor.IsStale());
+
+    Level->MarkPendingKill();
+    GUObjectArray.PerformGarbageCollector();
+}
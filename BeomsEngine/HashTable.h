@@ -0,0 +1,617 @@
+#pragma once
+#include "Types.h"
+#include "Memory.h"
+#include "Array.h"
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// SSE2가 있으면 컨트롤 바이트 16개를 한 번에 비교한다 (x64는 항상 SSE2 지원)
+#ifndef HASHTABLE_USE_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HASHTABLE_USE_SSE2 1
+#else
+#define HASHTABLE_USE_SSE2 0
+#endif
+#endif
+
+#if HASHTABLE_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// 컨트롤 바이트 값 - 0~127은 사용 중인 슬롯의 해시 하위 7비트(H2), 음수는 비어 있거나 지워진 슬롯
+namespace HashTableCtrl
+{
+    static constexpr int8 Empty = -128;     // 0b10000000 - 한 번도 쓰이지 않은 슬롯 (탐색 종료 지점)
+    static constexpr int8 Deleted = -2;     // 0b11111110 - 지워진 슬롯 (탐색은 계속 진행)
+
+    static constexpr int32 GroupWidth = 16;
+
+    // 아직 할당하지 않은 테이블이 가리키는 빈 그룹 - 할당 전에도 반복자가 같은 코드로 동작한다
+    alignas(16) inline constexpr int8 EmptyGroup[ GroupWidth ] = {
+        Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+        Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty };
+
+    inline bool IsFull(int8 Ctrl) { return Ctrl >= 0; }
+}
+
+// 컨트롤 바이트 16개에 대한 비교 결과를 비트마스크(비트 i = 슬롯 i)로 돌려준다
+struct FHashTableGroup
+{
+#if HASHTABLE_USE_SSE2
+    __m128i Ctrl;
+
+    explicit FHashTableGroup(const int8* Pos)
+        : Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos)))
+    {
+    }
+
+    uint32 Match(int8 H2) const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(H2), Ctrl)));
+    }
+
+    uint32 MatchEmpty() const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(HashTableCtrl::Empty), Ctrl)));
+    }
+
+    // Empty(-128)와 Deleted(-2)만 -1보다 작다
+    uint32 MatchEmptyOrDeleted() const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Ctrl)));
+    }
+
+    // 사용 중인 슬롯은 부호 비트가 0
+    uint32 MatchFull() const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(Ctrl)) ^ 0xFFFFu;
+    }
+#else
+    int8 Ctrl[ HashTableCtrl::GroupWidth ];
+
+    explicit FHashTableGroup(const int8* Pos)
+    {
+        std::memcpy(Ctrl, Pos, sizeof(Ctrl));
+    }
+
+    template<typename PredicateType>
+    uint32 MatchIf(PredicateType Predicate) const
+    {
+        uint32 Mask = 0;
+        for (int32 i = 0; i < HashTableCtrl::GroupWidth; ++i)
+        {
+            Mask |= static_cast<uint32>(Predicate(Ctrl[ i ])) << i;
+        }
+        return Mask;
+    }
+
+    uint32 Match(int8 H2) const { return MatchIf([H2](int8 C) { return C == H2; }); }
+    uint32 MatchEmpty() const { return MatchIf([](int8 C) { return C == HashTableCtrl::Empty; }); }
+    uint32 MatchEmptyOrDeleted() const { return MatchIf([](int8 C) { return C < -1; }); }
+    uint32 MatchFull() const { return MatchIf([](int8 C) { return C >= 0; }); }
+#endif
+};
+
+// 키 해시 - std::hash 특수화(FName, TWeakObjectPtr 등)를 그대로 쓰되
+// 정수/포인터처럼 std::hash가 항등 함수인 경우에도 상위 비트가 고르게 섞이도록 한 번 더 섞는다.
+template<typename KeyType>
+struct TDefaultHash
+{
+    size_t operator()(const KeyType& Key) const
+    {
+        uint64 Hash = static_cast<uint64>(std::hash<KeyType>()(Key));
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdULL;
+        Hash ^= Hash >> 33;
+        return static_cast<size_t>(Hash);
+    }
+};
+
+// 열린 주소법 해시 테이블 (SwissTable 방식)
+// - 원소는 한 번의 할당 안에 [컨트롤 바이트 | 슬롯 배열] 형태로 연속 저장된다 (원소당 할당/포인터 추적 없음)
+// - 해시 상위 비트(H1)로 시작 그룹을 고르고, 하위 7비트(H2)를 컨트롤 바이트에 저장해 16개씩 한 번에 비교한다
+// - 최대 적재율은 7/8이며 지운 자리는 Deleted로 남겨 두었다가 다음 재해시 때 정리한다
+// - 재해시하면 원소가 이동하므로 삽입은 반복자/참조를 무효화한다 (std::unordered_map과 다른 점)
+// KeyFuncs는 KeyType과 static GetKey(const ElementType&)를 제공한다.
+template<typename ElementType, typename KeyFuncs, typename HasherType, typename KeyEqualType>
+class TFlatHashTable
+{
+public:
+    using KeyType = typename KeyFuncs::KeyType;
+    using SizeType = int32;
+
+    template<bool bConst>
+    class TBaseIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+
+        TBaseIterator() = default;
+
+        TBaseIterator(const int8* InCtrl, pointer InSlot, const int8* InCtrlEnd)
+            : Ctrl(InCtrl), Slot(InSlot), CtrlEnd(InCtrlEnd)
+        {
+        }
+
+        // iterator -> const_iterator 변환
+        template<bool bOtherConst, typename = std::enable_if_t<bConst && !bOtherConst>>
+        TBaseIterator(const TBaseIterator<bOtherConst>& Other)
+            : Ctrl(Other.Ctrl), Slot(Other.Slot), CtrlEnd(Other.CtrlEnd)
+        {
+        }
+
+        reference operator*() const { return *Slot; }
+        pointer operator->() const { return Slot; }
+
+        TBaseIterator& operator++()
+        {
+            ++Ctrl;
+            ++Slot;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        TBaseIterator operator++(int)
+        {
+            TBaseIterator Temp = *this;
+            ++(*this);
+            return Temp;
+        }
+
+        bool operator==(const TBaseIterator& Other) const { return Ctrl == Other.Ctrl; }
+        bool operator!=(const TBaseIterator& Other) const { return Ctrl != Other.Ctrl; }
+
+    private:
+        template<bool> friend class TBaseIterator;
+        friend class TFlatHashTable;
+
+        const int8* Ctrl = nullptr;
+        pointer Slot = nullptr;
+        const int8* CtrlEnd = nullptr;
+
+        // 그룹 단위로 다음 사용 중인 슬롯까지 건너뛴다 (복제 바이트 영역은 넘지 않는다)
+        void SkipEmptySlots()
+        {
+            while (Ctrl < CtrlEnd)
+            {
+                const uint32 FullMask = FHashTableGroup(Ctrl).MatchFull();
+                if (FullMask)
+                {
+                    const int32 Shift = std::countr_zero(FullMask);
+                    Ctrl += Shift;
+                    Slot += Shift;
+                    if (Ctrl > CtrlEnd)
+                    {
+                        Ctrl = CtrlEnd;
+                    }
+                    return;
+                }
+                Ctrl += HashTableCtrl::GroupWidth;
+                Slot += HashTableCtrl::GroupWidth;
+            }
+            Ctrl = CtrlEnd;
+        }
+    };
+
+    using iterator = TBaseIterator<false>;
+    using const_iterator = TBaseIterator<true>;
+
+    TFlatHashTable() = default;
+
+    TFlatHashTable(const TFlatHashTable& Other)
+    {
+        Reserve(Other.Size);
+        for (const ElementType& Element : Other)
+        {
+            EmplaceNew(KeyFuncs::GetKey(Element), Element);
+        }
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    ~TFlatHashTable()
+    {
+        DestroyAll();
+        Deallocate();
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        if (this != &Other)
+        {
+            TFlatHashTable Copy(Other);
+            *this = std::move(Copy);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAll();
+            Deallocate();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    SizeType Num() const { return Size; }
+    SizeType GetCapacity() const { return Capacity; }
+    bool IsEmpty() const { return Size == 0; }
+
+    // 원소를 모두 지우되 할당은 유지한다
+    void Reset()
+    {
+        DestroyAll();
+        if (Capacity > 0)
+        {
+            std::memset(Ctrl, HashTableCtrl::Empty, Capacity + HashTableCtrl::GroupWidth);
+        }
+        Size = 0;
+        GrowthLeft = MaxLoadForCapacity(Capacity);
+    }
+
+    // 원소를 모두 지우고 ExpectedNumElements만큼만 남기고 메모리를 돌려준다
+    void Empty(SizeType ExpectedNumElements = 0)
+    {
+        DestroyAll();
+        Deallocate();
+        if (ExpectedNumElements > 0)
+        {
+            Reserve(ExpectedNumElements);
+        }
+    }
+
+    void Reserve(SizeType NumElements)
+    {
+        const SizeType NewCapacity = CapacityForNum(NumElements);
+        if (NewCapacity > Capacity)
+        {
+            Resize(NewCapacity);
+        }
+    }
+
+    // ------------------------------------------------------------
+    // 탐색
+    // ------------------------------------------------------------
+
+    template<typename LookupKeyType>
+    SizeType FindIndex(const LookupKeyType& Key) const
+    {
+        if (Size == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const size_t Hash = Hasher(Key);
+        const int8 H2 = GetH2(Hash);
+        const size_t Mask = static_cast<size_t>(Capacity) - 1;
+        size_t Pos = GetH1(Hash) & Mask;
+        size_t Stride = 0;
+
+        while (true)
+        {
+            const FHashTableGroup Group(Ctrl + Pos);
+            for (uint32 Match = Group.Match(H2); Match; Match &= Match - 1)
+            {
+                const size_t Index = (Pos + std::countr_zero(Match)) & Mask;
+                if (KeyEqual(KeyFuncs::GetKey(Slots[ Index ]), Key))
+                {
+                    return static_cast<SizeType>(Index);
+                }
+            }
+
+            if (Group.MatchEmpty())
+            {
+                return INDEX_NONE;
+            }
+
+            // 삼각수 간격 탐사 - 용량이 2의 거듭제곱이므로 모든 그룹을 한 번씩 방문한다
+            Stride += HashTableCtrl::GroupWidth;
+            Pos = (Pos + Stride) & Mask;
+        }
+    }
+
+    ElementType& GetElement(SizeType Index) { return Slots[ Index ]; }
+    const ElementType& GetElement(SizeType Index) const { return Slots[ Index ]; }
+
+    // ------------------------------------------------------------
+    // 삽입 / 삭제
+    // ------------------------------------------------------------
+
+    // 키가 없을 때만 Args로 원소를 만든다. 반환값은 (슬롯 인덱스, 새로 만들었는지)
+    template<typename... ArgsType>
+    std::pair<SizeType, bool> FindOrEmplace(const KeyType& Key, ArgsType&&... Args)
+    {
+        const SizeType ExistingIndex = FindIndex(Key);
+        if (ExistingIndex != INDEX_NONE)
+        {
+            return { ExistingIndex, false };
+        }
+        return { EmplaceNew(Key, std::forward<ArgsType>(Args)...), true };
+    }
+
+    // 키가 테이블에 없음을 호출자가 보장할 때 사용
+    template<typename... ArgsType>
+    SizeType EmplaceNew(const KeyType& Key, ArgsType&&... Args)
+    {
+        if (Capacity == 0)
+        {
+            Resize(HashTableCtrl::GroupWidth);
+        }
+
+        const size_t Hash = Hasher(Key);
+        SizeType Index = FindFirstNonFull(Hash);
+
+        // 남은 여유가 없으면 재해시 - Deleted 자리를 재사용하는 경우는 적재율이 늘지 않는다
+        if (GrowthLeft == 0 && Ctrl[ Index ] != HashTableCtrl::Deleted)
+        {
+            RehashForInsert();
+            Index = FindFirstNonFull(Hash);
+        }
+
+        if (Ctrl[ Index ] == HashTableCtrl::Empty)
+        {
+            --GrowthLeft;
+        }
+
+        new (Slots + Index) ElementType(std::forward<ArgsType>(Args)...);
+        SetCtrl(Index, GetH2(Hash));
+        ++Size;
+        return Index;
+    }
+
+    void RemoveAt(SizeType Index)
+    {
+        assert(Index >= 0 && Index < Capacity && HashTableCtrl::IsFull(Ctrl[ Index ]));
+
+        Slots[ Index ].~ElementType();
+        --Size;
+
+        // 이 슬롯을 포함하는 어떤 16칸 창에도 빈 슬롯이 있었다면 이 슬롯을 지나쳐 탐색이 이어진 적이 없으므로
+        // Empty로 되돌려도 된다. 그렇지 않으면 탐색 체인을 끊지 않도록 Deleted로 남긴다.
+        const size_t Mask = static_cast<size_t>(Capacity) - 1;
+        const size_t IndexBefore = (static_cast<size_t>(Index) - HashTableCtrl::GroupWidth) & Mask;
+        const uint32 EmptyAfter = FHashTableGroup(Ctrl + Index).MatchEmpty();
+        const uint32 EmptyBefore = FHashTableGroup(Ctrl + IndexBefore).MatchEmpty();
+
+        const int32 EmptyRunBefore = EmptyBefore ? std::countl_zero(static_cast<uint16>(EmptyBefore)) : HashTableCtrl::GroupWidth;
+        const int32 EmptyRunAfter = EmptyAfter ? std::countr_zero(EmptyAfter) : HashTableCtrl::GroupWidth;
+        const bool bWasNeverFull = EmptyBefore && EmptyAfter && (EmptyRunBefore + EmptyRunAfter) < HashTableCtrl::GroupWidth;
+
+        SetCtrl(Index, bWasNeverFull ? HashTableCtrl::Empty : HashTableCtrl::Deleted);
+        if (bWasNeverFull)
+        {
+            ++GrowthLeft;
+        }
+    }
+
+    template<typename LookupKeyType>
+    SizeType Remove(const LookupKeyType& Key)
+    {
+        const SizeType Index = FindIndex(Key);
+        if (Index == INDEX_NONE)
+        {
+            return 0;
+        }
+        RemoveAt(Index);
+        return 1;
+    }
+
+    // ------------------------------------------------------------
+    // 반복자
+    // ------------------------------------------------------------
+
+    iterator begin()
+    {
+        iterator It(Ctrl, Slots, Ctrl + Capacity);
+        It.SkipEmptySlots();
+        return It;
+    }
+
+    const_iterator begin() const
+    {
+        const_iterator It(Ctrl, Slots, Ctrl + Capacity);
+        It.SkipEmptySlots();
+        return It;
+    }
+
+    iterator end() { return iterator(Ctrl + Capacity, Slots + Capacity, Ctrl + Capacity); }
+    const_iterator end() const { return const_iterator(Ctrl + Capacity, Slots + Capacity, Ctrl + Capacity); }
+
+    iterator MakeIterator(SizeType Index)
+    {
+        return Index == INDEX_NONE ? end() : iterator(Ctrl + Index, Slots + Index, Ctrl + Capacity);
+    }
+
+    const_iterator MakeIterator(SizeType Index) const
+    {
+        return Index == INDEX_NONE ? end() : const_iterator(Ctrl + Index, Slots + Index, Ctrl + Capacity);
+    }
+
+    SizeType GetIteratorIndex(const_iterator It) const
+    {
+        return static_cast<SizeType>(It.Ctrl - Ctrl);
+    }
+
+private:
+    int8* Ctrl = const_cast<int8*>(HashTableCtrl::EmptyGroup);
+    ElementType* Slots = nullptr;
+    SizeType Size = 0;
+    SizeType Capacity = 0;      // 0 또는 16 이상의 2의 거듭제곱
+    SizeType GrowthLeft = 0;    // Empty 슬롯을 더 채울 수 있는 개수 (최대 적재율 기준)
+
+    // 해시/비교 함수 객체는 상태가 없다고 가정하고 필요할 때 만든다
+    template<typename LookupKeyType>
+    static size_t Hasher(const LookupKeyType& Key) { return HasherType()(Key); }
+
+    template<typename LookupKeyType>
+    static bool KeyEqual(const KeyType& A, const LookupKeyType& B) { return KeyEqualType()(A, B); }
+
+    static size_t GetH1(size_t Hash) { return Hash >> 7; }
+    static int8 GetH2(size_t Hash) { return static_cast<int8>(Hash & 0x7F); }
+
+    static SizeType MaxLoadForCapacity(SizeType InCapacity)
+    {
+        return InCapacity - InCapacity / 8;
+    }
+
+    static SizeType CapacityForNum(SizeType NumElements)
+    {
+        if (NumElements <= 0)
+        {
+            return 0;
+        }
+
+        SizeType NewCapacity = HashTableCtrl::GroupWidth;
+        while (MaxLoadForCapacity(NewCapacity) < NumElements)
+        {
+            NewCapacity *= 2;
+        }
+        return NewCapacity;
+    }
+
+    static size_t GetSlotsOffset(SizeType InCapacity)
+    {
+        const size_t CtrlBytes = static_cast<size_t>(InCapacity) + HashTableCtrl::GroupWidth;
+        return (CtrlBytes + alignof(ElementType) - 1) & ~(alignof(ElementType) - 1);
+    }
+
+    // 앞쪽 16개 컨트롤 바이트는 배열 끝에 복제해 두어 경계를 넘는 그룹도 한 번에 읽는다
+    void SetCtrl(SizeType Index, int8 Value)
+    {
+        Ctrl[ Index ] = Value;
+        if (Index < HashTableCtrl::GroupWidth)
+        {
+            Ctrl[ Capacity + Index ] = Value;
+        }
+    }
+
+    SizeType FindFirstNonFull(size_t Hash) const
+    {
+        const size_t Mask = static_cast<size_t>(Capacity) - 1;
+        size_t Pos = GetH1(Hash) & Mask;
+        size_t Stride = 0;
+
+        while (true)
+        {
+            const uint32 Mask16 = FHashTableGroup(Ctrl + Pos).MatchEmptyOrDeleted();
+            if (Mask16)
+            {
+                return static_cast<SizeType>((Pos + std::countr_zero(Mask16)) & Mask);
+            }
+            Stride += HashTableCtrl::GroupWidth;
+            Pos = (Pos + Stride) & Mask;
+        }
+    }
+
+    void RehashForInsert()
+    {
+        if (Size < MaxLoadForCapacity(Capacity) / 2)
+        {
+            // 대부분 Deleted로 찬 경우 - 같은 크기로 다시 만들어 정리한다
+            Resize(Capacity);
+        }
+        else
+        {
+            Resize(Capacity * 2);
+        }
+    }
+
+    void Resize(SizeType NewCapacity)
+    {
+        int8* OldCtrl = Ctrl;
+        ElementType* OldSlots = Slots;
+        const SizeType OldCapacity = Capacity;
+
+        const size_t SlotsOffset = GetSlotsOffset(NewCapacity);
+        const size_t AllocSize = SlotsOffset + sizeof(ElementType) * NewCapacity;
+        const size_t Alignment = alignof(ElementType) > HashTableCtrl::GroupWidth ? alignof(ElementType) : HashTableCtrl::GroupWidth;
+        uint8* Memory = static_cast<uint8*>(FMemory::Malloc(AllocSize, Alignment, FMemory::GetCurrentTag()));
+        if (!Memory)
+        {
+            // 멤버를 바꾸기 전이므로 테이블은 기존 상태 그대로 남는다
+            throw std::bad_alloc();
+        }
+
+        Ctrl = reinterpret_cast<int8*>(Memory);
+        Slots = reinterpret_cast<ElementType*>(Memory + SlotsOffset);
+        Capacity = NewCapacity;
+        GrowthLeft = MaxLoadForCapacity(NewCapacity) - Size;
+        std::memset(Ctrl, HashTableCtrl::Empty, NewCapacity + HashTableCtrl::GroupWidth);
+
+        for (SizeType i = 0; i < OldCapacity; ++i)
+        {
+            if (HashTableCtrl::IsFull(OldCtrl[ i ]))
+            {
+                const size_t Hash = Hasher(KeyFuncs::GetKey(OldSlots[ i ]));
+                const SizeType NewIndex = FindFirstNonFull(Hash);
+                RelocateConstructItems(Slots + NewIndex, OldSlots + i, 1);
+                SetCtrl(NewIndex, GetH2(Hash));
+            }
+        }
+
+        if (OldCapacity > 0)
+        {
+            FMemory::Free(OldCtrl);
+        }
+    }
+
+    void DestroyAll()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (SizeType i = 0; i < Capacity && Size > 0; ++i)
+            {
+                if (HashTableCtrl::IsFull(Ctrl[ i ]))
+                {
+                    Slots[ i ].~ElementType();
+                }
+            }
+        }
+    }
+
+    void Deallocate()
+    {
+        if (Capacity > 0)
+        {
+            FMemory::Free(Ctrl);
+        }
+        Ctrl = const_cast<int8*>(HashTableCtrl::EmptyGroup);
+        Slots = nullptr;
+        Size = 0;
+        Capacity = 0;
+        GrowthLeft = 0;
+    }
+
+    void StealFrom(TFlatHashTable& Other)
+    {
+        Ctrl = Other.Ctrl;
+        Slots = Other.Slots;
+        Size = Other.Size;
+        Capacity = Other.Capacity;
+        GrowthLeft = Other.GrowthLeft;
+
+        Other.Ctrl = const_cast<int8*>(HashTableCtrl::EmptyGroup);
+        Other.Slots = nullptr;
+        Other.Size = 0;
+        Other.Capacity = 0;
+        Other.GrowthLeft = 0;
+    }
+};
@@ -3,6 +3,8 @@
 
 FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateCubeMesh(FVector BoxRadius)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
+
     TArray<FVertex> Vertices;
     TArray<uint32> Indices;
     
@@ -69,6 +71,8 @@ FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateCubeMesh(FVector BoxRa
 
 FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateSphereMesh(float SphereRadius, int32 SphereSegments, int32 SphereRings)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
+
     TArray<FVertex> Vertices;
     TArray<uint32> Indices;
 
@@ -120,6 +124,8 @@ FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateSphereMesh(float Spher
 
 FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateCylinderMesh(float CylinderRadius, float CylinderHeight, int32 CylinderSegments)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
+
     TArray<FVertex> Vertices;
     TArray<uint32> Indices;
 
@@ -198,6 +204,8 @@ FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateCylinderMesh(float Cyl
 
 FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateConeMesh(float ConeRadius, float ConeHeight, int32 ConeSegments)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
+
     TArray<FVertex> Vertices;
     TArray<uint32> Indices;
 
@@ -258,6 +266,8 @@ FStaticMeshRenderData UKismetProceduralMeshLibrary::CreateConeMesh(float ConeRad
 
 FStaticMeshRenderData UKismetProceduralMeshLibrary::CreatePlaneMesh(FVector PlaneSize, int32 WidthSegments, int32 HeightSegments)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
+
     TArray<FVertex> Vertices;
     TArray<uint32> Indices;
 
@@ -20,6 +20,21 @@ ULevel::~ULevel()
     CleanupLevel();
 }
 
+void ULevel::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Super::AddReferencedObjects(Collector);
+
+    Collector.AddReferencedObjects(Actors);
+}
+
+void ULevel::BeginDestroy()
+{
+    // 액터들이 아직 살아 있을 때 EndPlay와 제거 알림을 보낸다
+    CleanupLevel();
+
+    Super::BeginDestroy();
+}
+
 void ULevel::BeginPlay()
 {
     if (!bIsLoaded)
@@ -85,6 +100,7 @@ void ULevel::AddActor(AActor* Actor)
 
     // 액터 추가
     Actors.push_back(Actor);
+    ReferenceWriteBarrier(Actor);
     RegisterActor(Actor);
     NotifyActorAdded(Actor);
 }
@@ -173,7 +189,7 @@ void ULevel::UnloadLevel()
 void ULevel::InitializeLevel()
 {
     // 레벨 초기화 로직
-    LevelName = FName("Level_" + GetUniqueID());
+    LevelName = FName("Level", NAME_EXTERNAL_TO_INTERNAL(static_cast<int32>(GetUniqueID())));
 }
 
 void ULevel::CleanupLevel()
@@ -227,7 +243,7 @@ ULevel::FLevelStats ULevel::GetLevelStats() const
     }
 
     // 메모리 사용량 계산 (근사치)
-    Stats.MemoryUsage = Stats.TotalActors * sizeof(AActor*);
+    Stats.MemoryUsage = Stats.TotalActors * sizeof(TObjectPtr<AActor>);
     Stats.MemoryUsage += sizeof(ULevel);
 
     return Stats;
@@ -293,7 +309,7 @@ void ULevel::ValidateActors()
 
 void ULevel::CleanupNullActors()
 {
-    // nullptr인 액터들 제거
+    // nullptr이거나 레벨을 거치지 않고 delete되어 nullptr로 풀리는 액터들 제거
     Actors.erase(
         std::remove(Actors.begin(), Actors.end(), nullptr),
         Actors.end()
@@ -2,6 +2,7 @@
 #include "Object.h"
 #include "Containers.h"
 #include "Actor.h"
+#include "ObjectPtr.h"
 
 // 전방 선언
 class UWorld;
@@ -19,6 +20,10 @@ public:
     // UObject 오버라이드
     virtual FString GetClassName() const override { return "ULevel"; }
 
+    // GC
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual void BeginDestroy() override;
+
     // 레벨 관리
     virtual void BeginPlay();
     virtual void EndPlay();
@@ -37,8 +42,12 @@ public:
     template<typename T>
     TArray<T*> GetActorsOfClass() const;
 
+    // 결과 배열을 호출자가 제공하는 버전 (TMemStackAllocator 배열을 넘기면 힙 할당 없음)
+    template<typename T, typename AllocatorType>
+    void GetActorsOfClass(TArray<T*, AllocatorType>& OutActors) const;
+
     // 액터 접근
-    const TArray<AActor*>& GetActors() const { return Actors; }
+    const TArray<TObjectPtr<AActor>>& GetActors() const { return Actors; }
     int32 GetNumActors() const { return static_cast<int32>(Actors.size()); }
 
     // 레벨 상태
@@ -88,8 +97,9 @@ public:
     FLevelStats GetLevelStats() const;
 
 protected:
-    // 액터 컨테이너
-    TArray<AActor*> Actors;
+    // 액터 컨테이너 - GC가 AddReferencedObjects로 따라가는 소유 참조
+    // 레벨을 거치지 않고 delete된 액터는 nullptr로 풀리고 Tick의 CleanupNullActors가 정리한다
+    TArray<TObjectPtr<AActor>> Actors;
 
     // 레벨 상태
     bool bIsLoaded;
@@ -136,6 +146,14 @@ template<typename T>
 TArray<T*> ULevel::GetActorsOfClass() const
 {
     TArray<T*> Result;
+    GetActorsOfClass<T>(Result);
+    return Result;
+}
+
+template<typename T, typename AllocatorType>
+void ULevel::GetActorsOfClass(TArray<T*, AllocatorType>& OutActors) const
+{
+    OutActors.clear();
 
     for (AActor* Actor : Actors)
     {
@@ -144,12 +162,10 @@ TArray<T*> ULevel::GetActorsOfClass() const
             T* CastedActor = Cast<T>(Actor);
             if (CastedActor)
             {
-                Result.push_back(CastedActor);
+                OutActors.push_back(CastedActor);
             }
         }
     }
-
-    return Result;
 }
 
 template<typename T>
@@ -1,4 +1,188 @@
 #pragma once
-#include <unordered_map>
+#include "HashTable.h"
+#include "Pair.h"
+#include <tuple>
+
+// 키와 값이 모두 memcpy로 옮겨도 되면 쌍도 그렇다 (재해시 시 원소 이동 비용)
 template<typename K, typename V>
-using TMap = std::unordered_map<K, V>;
\ No newline at end of file
+struct TIsTriviallyRelocatable<TPair<K, V>>
+{
+    static constexpr bool Value = TIsTriviallyRelocatable<K>::Value && TIsTriviallyRelocatable<V>::Value;
+};
+
+template<typename K, typename V>
+struct TMapKeyFuncs
+{
+    using KeyType = K;
+
+    static const K& GetKey(const TPair<K, V>& Element) { return Element.first; }
+};
+
+// 키-값 해시 맵 - 열린 주소법 플랫 테이블 위에 std::unordered_map과 같은 이름의 인터페이스를 얹었다
+// 원소는 TPair<K, V>(first/second)이며, 삽입 시 재해시가 일어나면 기존 반복자와 참조는 무효가 된다.
+template<typename K, typename V, typename HasherType = TDefaultHash<K>, typename KeyEqualType = std::equal_to<K>>
+class TMap
+{
+    using FTable = TFlatHashTable<TPair<K, V>, TMapKeyFuncs<K, V>, HasherType, KeyEqualType>;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = TPair<K, V>;
+    using size_type = size_t;
+    using iterator = typename FTable::iterator;
+    using const_iterator = typename FTable::const_iterator;
+
+    TMap() = default;
+
+    TMap(std::initializer_list<value_type> InitList)
+    {
+        Table.Reserve(static_cast<int32>(InitList.size()));
+        for (const value_type& Element : InitList)
+        {
+            insert(Element);
+        }
+    }
+
+    // ------------------------------------------------------------
+    // 엔진 스타일 인터페이스
+    // ------------------------------------------------------------
+
+    int32 Num() const { return Table.Num(); }
+    bool IsEmpty() const { return Table.IsEmpty(); }
+
+    // 이미 있는 키면 값을 덮어쓴다
+    template<typename ValueArgType>
+    V& Add(const K& Key, ValueArgType&& Value)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Key, Key, std::forward<ValueArgType>(Value));
+        if (!bInserted)
+        {
+            Table.GetElement(Index).second = std::forward<ValueArgType>(Value);
+        }
+        return Table.GetElement(Index).second;
+    }
+
+    V& FindOrAdd(const K& Key)
+    {
+        return Table.GetElement(Table.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple()).first).second;
+    }
+
+    V* Find(const K& Key)
+    {
+        const int32 Index = Table.FindIndex(Key);
+        return Index != INDEX_NONE ? &Table.GetElement(Index).second : nullptr;
+    }
+
+    const V* Find(const K& Key) const
+    {
+        const int32 Index = Table.FindIndex(Key);
+        return Index != INDEX_NONE ? &Table.GetElement(Index).second : nullptr;
+    }
+
+    // 없으면 기본값을 돌려준다 (포인터 값 맵에서 주로 사용)
+    V FindRef(const K& Key) const
+    {
+        const V* Value = Find(Key);
+        return Value ? *Value : V();
+    }
+
+    bool Contains(const K& Key) const { return Table.FindIndex(Key) != INDEX_NONE; }
+
+    int32 Remove(const K& Key) { return Table.Remove(Key); }
+
+    void Reserve(int32 NumElements) { Table.Reserve(NumElements); }
+    void Reset() { Table.Reset(); }
+    void Empty(int32 ExpectedNumElements = 0) { Table.Empty(ExpectedNumElements); }
+
+    // ------------------------------------------------------------
+    // std::unordered_map 호환 인터페이스
+    // ------------------------------------------------------------
+
+    size_type size() const { return static_cast<size_type>(Table.Num()); }
+    bool empty() const { return Table.IsEmpty(); }
+
+    // 기존 unordered_map::clear처럼 원소만 지우고 버킷(할당)은 유지한다
+    void clear() { Table.Reset(); }
+    void reserve(size_type Count) { Table.Reserve(static_cast<int32>(Count)); }
+
+    iterator begin() { return Table.begin(); }
+    const_iterator begin() const { return Table.begin(); }
+    const_iterator cbegin() const { return Table.begin(); }
+    iterator end() { return Table.end(); }
+    const_iterator end() const { return Table.end(); }
+    const_iterator cend() const { return Table.end(); }
+
+    iterator find(const K& Key) { return Table.MakeIterator(Table.FindIndex(Key)); }
+    const_iterator find(const K& Key) const { return Table.MakeIterator(Table.FindIndex(Key)); }
+
+    size_type count(const K& Key) const { return Contains(Key) ? 1 : 0; }
+    bool contains(const K& Key) const { return Contains(Key); }
+
+    V& operator[](const K& Key) { return FindOrAdd(Key); }
+
+    V& at(const K& Key)
+    {
+        V* Value = Find(Key);
+        assert(Value && "TMap::at - key not found");
+        return *Value;
+    }
+
+    const V& at(const K& Key) const
+    {
+        const V* Value = Find(Key);
+        assert(Value && "TMap::at - key not found");
+        return *Value;
+    }
+
+    template<typename... ArgsType>
+    std::pair<iterator, bool> try_emplace(const K& Key, ArgsType&&... Args)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Key, std::piecewise_construct,
+            std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgsType>(Args)...));
+        return { Table.MakeIterator(Index), bInserted };
+    }
+
+    template<typename KeyArgType, typename ValueArgType>
+    std::pair<iterator, bool> emplace(KeyArgType&& Key, ValueArgType&& Value)
+    {
+        return insert(value_type(std::forward<KeyArgType>(Key), std::forward<ValueArgType>(Value)));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& Element)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Element.first, Element);
+        return { Table.MakeIterator(Index), bInserted };
+    }
+
+    std::pair<iterator, bool> insert(value_type&& Element)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Element.first, std::move(Element));
+        return { Table.MakeIterator(Index), bInserted };
+    }
+
+    template<typename ValueArgType>
+    std::pair<iterator, bool> insert_or_assign(const K& Key, ValueArgType&& Value)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Key, Key, std::forward<ValueArgType>(Value));
+        if (!bInserted)
+        {
+            Table.GetElement(Index).second = std::forward<ValueArgType>(Value);
+        }
+        return { Table.MakeIterator(Index), bInserted };
+    }
+
+    size_type erase(const K& Key) { return static_cast<size_type>(Table.Remove(Key)); }
+
+    // 지운 원소의 다음 원소를 가리키는 반복자를 돌려준다 (삭제는 다른 원소를 옮기지 않는다)
+    iterator erase(const_iterator It)
+    {
+        const int32 Index = Table.GetIteratorIndex(It);
+        Table.RemoveAt(Index);
+        iterator Next = Table.MakeIterator(Index);
+        return ++Next;
+    }
+
+private:
+    FTable Table;
+};
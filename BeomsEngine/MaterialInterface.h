@@ -95,22 +95,22 @@ public:
     // 파라미터 접근 함수들
     virtual bool GetScalarParameterValue(const FMaterialParameterInfo& ParameterInfo, float& OutValue) const
     {
-        if (ParameterInfo.Name == FName("Opacity"))
+        if (ParameterInfo.Name == EName::Opacity)
         {
             OutValue = Opacity;
             return true;
         }
-        else if (ParameterInfo.Name == FName("Metallic"))
+        else if (ParameterInfo.Name == EName::Metallic)
         {
             OutValue = Metallic;
             return true;
         }
-        else if (ParameterInfo.Name == FName("Specular"))
+        else if (ParameterInfo.Name == EName::Specular)
         {
             OutValue = Specular;
             return true;
         }
-        else if (ParameterInfo.Name == FName("Roughness"))
+        else if (ParameterInfo.Name == EName::Roughness)
         {
             OutValue = Roughness;
             return true;
@@ -120,17 +120,17 @@ public:
 
     virtual bool GetVectorParameterValue(const FMaterialParameterInfo& ParameterInfo, FVector& OutValue) const
     {
-        if (ParameterInfo.Name == FName("BaseColor"))
+        if (ParameterInfo.Name == EName::BaseColor)
         {
             OutValue = BaseColor;
             return true;
         }
-        else if (ParameterInfo.Name == FName("EmissiveColor"))
+        else if (ParameterInfo.Name == EName::EmissiveColor)
         {
             OutValue = EmissiveColor;
             return true;
         }
-        else if (ParameterInfo.Name == FName("Normal"))
+        else if (ParameterInfo.Name == EName::Normal)
         {
             OutValue = Normal;
             return true;
@@ -0,0 +1,125 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Vector4.h"
+#include <random>
+
+namespace
+{
+    // SIMD 이전의 스칼라 구현 (비교용)
+    FMatrix ScalarMultiply(const FMatrix& A, const FMatrix& B)
+    {
+        FMatrix Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[ Row ][ Column ] =
+                    A.M[ Row ][ 0 ] * B.M[ 0 ][ Column ] +
+                    A.M[ Row ][ 1 ] * B.M[ 1 ][ Column ] +
+                    A.M[ Row ][ 2 ] * B.M[ 2 ][ Column ] +
+                    A.M[ Row ][ 3 ] * B.M[ 3 ][ Column ];
+            }
+        }
+        return Result;
+    }
+
+    FMatrix ScalarTranspose(const FMatrix& A)
+    {
+        FMatrix Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[ Row ][ Column ] = A.M[ Column ][ Row ];
+            }
+        }
+        return Result;
+    }
+
+    void ReportMathPair(const char* Name, const TPair<double, double>& Times, double Scale)
+    {
+        const double ScalarTime = Times.first * Scale;
+        const double VectorTime = Times.second * Scale;
+        FBenchmark::Report("%-34s scalar %7.2f ns   FMatrix %7.2f ns   (x%.2f)\n", Name, ScalarTime, VectorTime, ScalarTime / VectorTime);
+    }
+}
+
+// FMatrix 커널 - VectorRegister SIMD 경로
+// 스칼라 열은 이 파일의 참조 구현이다. Determinant/Inverse는 참조 구현이 없으므로
+// PLATFORM_ENABLE_VECTORINTRINSICS=0으로 빌드한 결과와 비교한다.
+IMPLEMENT_BENCHMARK(MatrixKernels)
+{
+    FBenchmark::Report("simd=%d fma=%d\n", PLATFORM_ENABLE_VECTORINTRINSICS, PLATFORM_ENABLE_VECTORINTRINSICS_FMA);
+
+    const int32 NumMatrices = 256;
+    const int32 NumIterations = 200000;
+    const int32 NumRuns = 15;
+    const double PerIteration = 1000.0 / NumIterations;
+
+    std::mt19937 Random(7);
+    std::uniform_real_distribution<float> Distribution(-3.0f, 3.0f);
+
+    TArray<FMatrix> Matrices(NumMatrices);
+    for (FMatrix& Matrix : Matrices)
+    {
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Matrix.M[ Row ][ Column ] = Distribution(Random);
+            }
+        }
+    }
+    Matrices[ 0 ] = FMatrix::CreateTranslation(FVector(1, 2, 3)) * FMatrix::CreateRotationFromEuler(0.3f, 0.2f, 0.1f) * FMatrix::CreateScale(FVector(2, 3, 4));
+
+    const int32 Mask = NumMatrices - 1;
+    float Sum = 0.0f;
+
+    ReportMathPair("FMatrix * FMatrix", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { for (int32 i = 0; i < NumIterations; ++i) Sum += ScalarMultiply(Matrices[ i & Mask ], Matrices[ (i + 1) & Mask ]).M[ 1 ][ 2 ]; },
+        [&]() { for (int32 i = 0; i < NumIterations; ++i) Sum += (Matrices[ i & Mask ] * Matrices[ (i + 1) & Mask ]).M[ 1 ][ 2 ]; }), PerIteration);
+
+    ReportMathPair("Transpose", FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { for (int32 i = 0; i < NumIterations; ++i) Sum += ScalarTranspose(Matrices[ i & Mask ]).M[ 1 ][ 2 ]; },
+        [&]() { for (int32 i = 0; i < NumIterations; ++i) Sum += Matrices[ i & Mask ].Transpose().M[ 1 ][ 2 ]; }), PerIteration);
+
+    const double DeterminantTime = FBenchmark::MeasureBest(NumRuns, [&]() { for (int32 i = 0; i < NumIterations; ++i) Sum += Matrices[ i & Mask ].Determinant(); });
+    const double InverseTime = FBenchmark::MeasureBest(NumRuns, [&]() { for (int32 i = 0; i < NumIterations; ++i) Sum += Matrices[ i & Mask ].Inverse().M[ 1 ][ 2 ]; });
+    FBenchmark::Report("%-34s %7.2f ns\n", "Determinant", DeterminantTime * PerIteration);
+    FBenchmark::Report("%-34s %7.2f ns\n", "Inverse", InverseTime * PerIteration);
+
+    // 배열 변환 - 스칼라 열은 원소마다 단일 변환 함수를 부른다
+    const int32 NumPoints = 4096;
+    const int32 NumBatchRuns = 50;
+    const double PerPoint = 1000.0 / NumPoints;
+
+    TArray<FVector> Points(NumPoints);
+    TArray<FVector> OutPoints(NumPoints);
+    for (FVector& Point : Points)
+    {
+        Point = FVector(Distribution(Random), Distribution(Random), Distribution(Random));
+    }
+    TArray<FVector4> Vectors(NumPoints);
+    TArray<FVector4> OutVectors(NumPoints);
+    for (FVector4& Vector : Vectors)
+    {
+        Vector = FVector4(Distribution(Random), Distribution(Random), Distribution(Random), 1.0f);
+    }
+
+    const FMatrix& Affine = Matrices[ 0 ];
+    const FMatrix Projection = FMatrix::CreatePerspective(1.0f, 1.5f, 0.1f, 1000.0f);
+
+    ReportMathPair("TransformPositions (per point)", FBenchmark::MeasureBestInterleaved(NumBatchRuns,
+        [&]() { for (int32 i = 0; i < NumPoints; ++i) OutPoints[ i ] = Affine.TransformPosition(Points[ i ]); Sum += OutPoints[ 7 ].X; },
+        [&]() { Affine.TransformPositions(Points.GetData(), OutPoints.GetData(), NumPoints); Sum += OutPoints[ 7 ].X; }), PerPoint);
+
+    ReportMathPair("TransformDirections (per point)", FBenchmark::MeasureBestInterleaved(NumBatchRuns,
+        [&]() { for (int32 i = 0; i < NumPoints; ++i) OutPoints[ i ] = Affine.TransformDirection(Points[ i ]); Sum += OutPoints[ 7 ].X; },
+        [&]() { Affine.TransformDirections(Points.GetData(), OutPoints.GetData(), NumPoints); Sum += OutPoints[ 7 ].X; }), PerPoint);
+
+    ReportMathPair("TransformVectors (per vector)", FBenchmark::MeasureBestInterleaved(NumBatchRuns,
+        [&]() { for (int32 i = 0; i < NumPoints; ++i) OutVectors[ i ] = Projection * Vectors[ i ]; Sum += OutVectors[ 7 ].X; },
+        [&]() { Projection.TransformVectors(Vectors.GetData(), OutVectors.GetData(), NumPoints); Sum += OutVectors[ 7 ].X; }), PerPoint);
+
+    FBenchmark::Consume(Sum);
+}
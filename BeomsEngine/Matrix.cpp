@@ -13,4 +13,79 @@ const FMatrix FMatrix::Zero(
     0.0f, 0.0f, 0.0f, 0.0f,
     0.0f, 0.0f, 0.0f, 0.0f,
     0.0f, 0.0f, 0.0f, 0.0f
-);
\ No newline at end of file
+);
+
+namespace
+{
+    // 열 벡터 규약(M * V)에서는 결과 = 열0 * X + 열1 * Y + 열2 * Z + 열3 * W
+    struct FMatrixColumns
+    {
+        VectorRegister Columns[ 4 ];
+
+        explicit FMatrixColumns(const FMatrix& Matrix)
+        {
+            float Transposed[ 16 ];
+            VectorMatrixTranspose(Transposed, &Matrix.M[0][0]);
+            for (int32 i = 0; i < 4; ++i)
+            {
+                Columns[ i ] = VectorLoad(Transposed + i * 4);
+            }
+        }
+    };
+
+    // 마지막 행이 (0, 0, 0, 1)이면 W 나누기가 필요 없다
+    bool IsAffine(const FMatrix& Matrix)
+    {
+        return Matrix.M[3][0] == 0.0f && Matrix.M[3][1] == 0.0f && Matrix.M[3][2] == 0.0f && Matrix.M[3][3] == 1.0f;
+    }
+}
+
+void FMatrix::TransformPositions(const FVector* InPositions, FVector* OutPositions, int32 Count) const
+{
+    if (!IsAffine(*this))
+    {
+        // 투영 행렬 - 점마다 W로 나눠야 하므로 단일 변환을 그대로 쓴다
+        for (int32 i = 0; i < Count; ++i)
+        {
+            OutPositions[ i ] = TransformPosition(InPositions[ i ]);
+        }
+        return;
+    }
+
+    const FMatrixColumns Matrix(*this);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const float* Position = &InPositions[ i ].X;
+        VectorRegister Result = VectorMultiplyAdd(VectorLoadFloat1(Position + 0), Matrix.Columns[ 0 ], Matrix.Columns[ 3 ]);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Position + 1), Matrix.Columns[ 1 ], Result);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Position + 2), Matrix.Columns[ 2 ], Result);
+        VectorStoreFloat3(Result, &OutPositions[ i ].X);
+    }
+}
+
+void FMatrix::TransformDirections(const FVector* InDirections, FVector* OutDirections, int32 Count) const
+{
+    const FMatrixColumns Matrix(*this);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const float* Direction = &InDirections[ i ].X;
+        VectorRegister Result = VectorMultiply(VectorLoadFloat1(Direction + 0), Matrix.Columns[ 0 ]);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Direction + 1), Matrix.Columns[ 1 ], Result);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Direction + 2), Matrix.Columns[ 2 ], Result);
+        VectorStoreFloat3(Result, &OutDirections[ i ].X);
+    }
+}
+
+void FMatrix::TransformVectors(const FVector4* InVectors, FVector4* OutVectors, int32 Count) const
+{
+    const FMatrixColumns Matrix(*this);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const float* Vector = &InVectors[ i ].X;
+        VectorRegister Result = VectorMultiply(VectorLoadFloat1(Vector + 0), Matrix.Columns[ 0 ]);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Vector + 1), Matrix.Columns[ 1 ], Result);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Vector + 2), Matrix.Columns[ 2 ], Result);
+        Result = VectorMultiplyAdd(VectorLoadFloat1(Vector + 3), Matrix.Columns[ 3 ], Result);
+        VectorStore(Result, &OutVectors[ i ].X);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "Vector.h"
 #include "Vector4.h"
+#include "VectorRegister.h"
 #include <cmath>
 
 struct FMatrix
@@ -64,17 +65,7 @@ public:
     FMatrix operator*(const FMatrix& Other) const
     {
         FMatrix Result;
-        for (int i = 0; i < 4; ++i)
-        {
-            for (int j = 0; j < 4; ++j)
-            {
-                Result.M[i][j] = 0.0f;
-                for (int k = 0; k < 4; ++k)
-                {
-                    Result.M[i][j] += M[i][k] * Other.M[k][j];
-                }
-            }
-        }
+        VectorMatrixMultiply(&Result.M[0][0], &M[0][0], &Other.M[0][0]);
         return Result;
     }
 
@@ -117,7 +108,7 @@ public:
 
     FMatrix& operator*=(const FMatrix& Other)
     {
-        *this = *this * Other;
+        VectorMatrixMultiply(&M[0][0], &M[0][0], &Other.M[0][0]);
         return *this;
     }
 
@@ -152,6 +143,8 @@ public:
         return !(*this == Other);
     }
 
+    // 벡터 하나짜리 변환은 스칼라 내적이 더 빠르다 - 스칼라 레지스터의 성분을 SIMD로 모으고
+    // 결과를 다시 가로로 더하는 비용이 곱셈 16번보다 크다. 여러 개를 변환할 때는 아래 배열 함수를 쓴다.
     FVector4 operator*(const FVector4& Vector) const
     {
         return FVector4(
@@ -176,78 +169,36 @@ public:
         return FVector(Result.X, Result.Y, Result.Z);
     }
 
+    // 배열 단위 변환 - 행렬 열을 한 번만 레지스터에 올려 두고 원소마다 곱셈-덧셈 3~4번으로 끝낸다
+    // In과 Out은 같은 배열이어도 된다.
+    void TransformPositions(const FVector* InPositions, FVector* OutPositions, int32 Count) const;
+    void TransformDirections(const FVector* InDirections, FVector* OutDirections, int32 Count) const;
+    void TransformVectors(const FVector4* InVectors, FVector4* OutVectors, int32 Count) const;
+
     FMatrix Transpose() const
     {
         FMatrix Result;
-        for (int i = 0; i < 4; ++i)
-        {
-            for (int j = 0; j < 4; ++j)
-            {
-                Result.M[i][j] = M[j][i];
-            }
-        }
+        VectorMatrixTranspose(&Result.M[0][0], &M[0][0]);
         return Result;
     }
 
     void TransposeInPlace()
     {
-        for (int i = 0; i < 4; ++i)
-        {
-            for (int j = i + 1; j < 4; ++j)
-            {
-                float Temp = M[i][j];
-                M[i][j] = M[j][i];
-                M[j][i] = Temp;
-            }
-        }
+        VectorMatrixTranspose(&M[0][0], &M[0][0]);
     }
 
     float Determinant() const
     {
-        return 
-            M[0][0] * (M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - 
-                      M[1][2] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) + 
-                      M[1][3] * (M[2][1] * M[3][2] - M[2][2] * M[3][1])) -
-            M[0][1] * (M[1][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - 
-                      M[1][2] * (M[2][0] * M[3][3] - M[2][3] * M[3][0]) + 
-                      M[1][3] * (M[2][0] * M[3][2] - M[2][2] * M[3][0])) +
-            M[0][2] * (M[1][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - 
-                      M[1][1] * (M[2][0] * M[3][3] - M[2][3] * M[3][0]) + 
-                      M[1][3] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])) -
-            M[0][3] * (M[1][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) - 
-                      M[1][1] * (M[2][0] * M[3][2] - M[2][2] * M[3][0]) + 
-                      M[1][2] * (M[2][0] * M[3][1] - M[2][1] * M[3][0]));
+        return VectorMatrixDeterminant(&M[0][0]);
     }
 
     FMatrix Inverse() const
     {
-        float Det = Determinant();
+        FMatrix Result;
+        const float Det = VectorMatrixInverse(&Result.M[0][0], &M[0][0]);
         if (std::abs(Det) < 1e-6f)
             return FMatrix::Identity;
 
-        float InvDet = 1.0f / Det;
-        FMatrix Result;
-
-        Result.M[0][0] = (M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[1][2] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) + M[1][3] * (M[2][1] * M[3][2] - M[2][2] * M[3][1])) * InvDet;
-        Result.M[0][1] = (-M[0][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) + M[0][2] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - M[0][3] * (M[2][1] * M[3][2] - M[2][2] * M[3][1])) * InvDet;
-        Result.M[0][2] = (M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) - M[0][2] * (M[1][1] * M[3][3] - M[1][3] * M[3][1]) + M[0][3] * (M[1][1] * M[3][2] - M[1][2] * M[3][1])) * InvDet;
-        Result.M[0][3] = (-M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) + M[0][2] * (M[1][1] * M[2][3] - M[1][3] * M[2][1]) - M[0][3] * (M[1][1] * M[2][2] - M[1][2] * M[2][1])) * InvDet;
-
-        Result.M[1][0] = (-M[1][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) + M[1][2] * (M[2][0] * M[3][3] - M[2][3] * M[3][0]) - M[1][3] * (M[2][0] * M[3][2] - M[2][2] * M[3][0])) * InvDet;
-        Result.M[1][1] = (M[0][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[0][2] * (M[2][0] * M[3][3] - M[2][3] * M[3][0]) + M[0][3] * (M[2][0] * M[3][2] - M[2][2] * M[3][0])) * InvDet;
-        Result.M[1][2] = (-M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) + M[0][2] * (M[1][0] * M[3][3] - M[1][3] * M[3][0]) - M[0][3] * (M[1][0] * M[3][2] - M[1][2] * M[3][0])) * InvDet;
-        Result.M[1][3] = (M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) - M[0][2] * (M[1][0] * M[2][3] - M[1][3] * M[2][0]) + M[0][3] * (M[1][0] * M[2][2] - M[1][2] * M[2][0])) * InvDet;
-
-        Result.M[2][0] = (M[1][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - M[1][1] * (M[2][0] * M[3][3] - M[2][3] * M[3][0]) + M[1][3] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])) * InvDet;
-        Result.M[2][1] = (-M[0][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) + M[0][1] * (M[2][0] * M[3][3] - M[2][3] * M[3][0]) - M[0][3] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])) * InvDet;
-        Result.M[2][2] = (M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1]) - M[0][1] * (M[1][0] * M[3][3] - M[1][3] * M[3][0]) + M[0][3] * (M[1][0] * M[3][1] - M[1][1] * M[3][0])) * InvDet;
-        Result.M[2][3] = (-M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1]) + M[0][1] * (M[1][0] * M[2][3] - M[1][3] * M[2][0]) - M[0][3] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])) * InvDet;
-
-        Result.M[3][0] = (-M[1][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) + M[1][1] * (M[2][0] * M[3][2] - M[2][2] * M[3][0]) - M[1][2] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])) * InvDet;
-        Result.M[3][1] = (M[0][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) - M[0][1] * (M[2][0] * M[3][2] - M[2][2] * M[3][0]) + M[0][2] * (M[2][0] * M[3][1] - M[2][1] * M[3][0])) * InvDet;
-        Result.M[3][2] = (-M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1]) + M[0][1] * (M[1][0] * M[3][2] - M[1][2] * M[3][0]) - M[0][2] * (M[1][0] * M[3][1] - M[1][1] * M[3][0])) * InvDet;
-        Result.M[3][3] = (M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) - M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0]) + M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])) * InvDet;
-
         return Result;
     }
 
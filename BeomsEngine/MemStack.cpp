@@ -0,0 +1,168 @@
+#include "pch.h"
+#include "MemStack.h"
+
+namespace
+{
+    uint8* AlignPointer(uint8* Ptr, size_t Alignment)
+    {
+        uintptr_t Address = reinterpret_cast<uintptr_t>(Ptr);
+        Address = (Address + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+        return reinterpret_cast<uint8*>(Address);
+    }
+}
+
+FMemStack::FMemStack()
+    : Top(nullptr)
+    , End(nullptr)
+    , TopChunk(nullptr)
+    , UnusedChunks(nullptr)
+    , NumMarks(0)
+    , BytesReserved(0)
+{
+}
+
+FMemStack::~FMemStack()
+{
+    FreeChunks(nullptr);
+    ReleaseChunkList(UnusedChunks);
+    UnusedChunks = nullptr;
+}
+
+FMemStack& FMemStack::Get()
+{
+    thread_local FMemStack ThreadMemStack;
+    return ThreadMemStack;
+}
+
+void* FMemStack::Alloc(size_t Size, size_t Alignment)
+{
+    uint8* Result = AlignPointer(Top, Alignment);
+    if (!TopChunk || Result + Size > End)
+    {
+        AllocateNewChunk(Size + Alignment);
+        Result = AlignPointer(Top, Alignment);
+    }
+
+    Top = Result + Size;
+    return Result;
+}
+
+void FMemStack::Flush()
+{
+    assert(NumMarks == 0 && "FMemStack::Flush called with outstanding FMemMark");
+
+    FreeChunks(nullptr);
+    Top = nullptr;
+    End = nullptr;
+}
+
+size_t FMemStack::GetBytesUsed() const
+{
+    if (!TopChunk)
+    {
+        return 0;
+    }
+
+    size_t Used = static_cast<size_t>(Top - TopChunk->Data());
+    for (FChunk* Chunk = TopChunk->Next; Chunk; Chunk = Chunk->Next)
+    {
+        Used += Chunk->DataSize;
+    }
+    return Used;
+}
+
+void FMemStack::AllocateNewChunk(size_t MinSize)
+{
+    FChunk* Chunk = nullptr;
+    const size_t DefaultDataSize = ChunkSize - sizeof(FChunk);
+
+    if (MinSize <= DefaultDataSize && UnusedChunks)
+    {
+        // 캐시된 청크 재사용
+        Chunk = UnusedChunks;
+        UnusedChunks = Chunk->Next;
+    }
+    else
+    {
+        size_t AllocSize = ChunkSize;
+        if (MinSize > DefaultDataSize)
+        {
+            AllocSize = (MinSize + sizeof(FChunk) + ChunkSize - 1) & ~(ChunkSize - 1);
+        }
+
+        Chunk = static_cast<FChunk*>(FMemory::AllocPages(AllocSize, EMemoryTag::Containers));
+        Chunk->DataSize = AllocSize - sizeof(FChunk);
+        BytesReserved += AllocSize;
+    }
+
+    Chunk->Next = TopChunk;
+    TopChunk = Chunk;
+    Top = Chunk->Data();
+    End = Top + Chunk->DataSize;
+}
+
+void FMemStack::FreeChunks(FChunk* NewTopChunk)
+{
+    const size_t DefaultDataSize = ChunkSize - sizeof(FChunk);
+
+    while (TopChunk != NewTopChunk)
+    {
+        FChunk* Chunk = TopChunk;
+        TopChunk = Chunk->Next;
+
+        if (Chunk->DataSize == DefaultDataSize)
+        {
+            Chunk->Next = UnusedChunks;
+            UnusedChunks = Chunk;
+        }
+        else
+        {
+            // 큰 요청용 청크는 캐시하지 않는다
+            BytesReserved -= Chunk->DataSize + sizeof(FChunk);
+            FMemory::FreePages(Chunk, Chunk->DataSize + sizeof(FChunk), EMemoryTag::Containers);
+        }
+    }
+}
+
+void FMemStack::ReleaseChunkList(FChunk* Chunk)
+{
+    while (Chunk)
+    {
+        FChunk* Next = Chunk->Next;
+        FMemory::FreePages(Chunk, Chunk->DataSize + sizeof(FChunk), EMemoryTag::Containers);
+        Chunk = Next;
+    }
+}
+
+FMemMark::FMemMark(FMemStack& InMem)
+    : Mem(InMem)
+    , SavedTop(InMem.Top)
+    , SavedChunk(InMem.TopChunk)
+    , bPopped(false)
+{
+    ++Mem.NumMarks;
+}
+
+FMemMark::~FMemMark()
+{
+    Pop();
+}
+
+void FMemMark::Pop()
+{
+    if (bPopped)
+    {
+        return;
+    }
+
+    if (Mem.TopChunk != SavedChunk)
+    {
+        Mem.FreeChunks(SavedChunk);
+    }
+
+    Mem.Top = SavedTop;
+    Mem.End = SavedChunk ? SavedChunk->Data() + SavedChunk->DataSize : nullptr;
+
+    --Mem.NumMarks;
+    bPopped = true;
+}
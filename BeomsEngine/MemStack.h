@@ -0,0 +1,107 @@
+#pragma once
+#include "Types.h"
+#include "Memory.h"
+#include <cstddef>
+
+// 프레임 단위 선형(bump) 아레나
+// - 할당은 포인터 증가뿐이고 개별 해제는 없다.
+// - FMemMark 스코프가 끝나면 마크 이후의 할당이 한꺼번에 되돌려진다.
+// - 스레드마다 하나씩 존재하며 (FMemStack::Get) 프레임 시작 시 Flush로 초기화한다.
+class FMemStack
+{
+public:
+    static constexpr size_t ChunkSize = FMemory::PAGE_ALLOCATION_ALIGNMENT;
+
+    FMemStack();
+    ~FMemStack();
+
+    FMemStack(const FMemStack&) = delete;
+    FMemStack& operator=(const FMemStack&) = delete;
+
+    // 현재 스레드의 아레나
+    static FMemStack& Get();
+
+    void* Alloc(size_t Size, size_t Alignment);
+
+    template<typename T>
+    T* Alloc(size_t Count = 1)
+    {
+        return static_cast<T*>(Alloc(sizeof(T) * Count, alignof(T)));
+    }
+
+    // 프레임 경계에서 호출 - 열린 마크가 없어야 하며 청크는 재사용을 위해 보관한다
+    void Flush();
+
+    int32 GetNumMarks() const { return NumMarks; }
+    size_t GetBytesUsed() const;
+    size_t GetBytesReserved() const { return BytesReserved; }
+
+private:
+    friend class FMemMark;
+
+    struct FChunk
+    {
+        FChunk* Next;       // 스택 아래쪽(이전) 청크
+        size_t DataSize;    // 헤더를 제외한 사용 가능 크기
+
+        uint8* Data() { return reinterpret_cast<uint8*>(this + 1); }
+    };
+
+    uint8* Top;
+    uint8* End;
+    FChunk* TopChunk;
+    FChunk* UnusedChunks;   // 팝된 기본 크기 청크 캐시
+
+    int32 NumMarks;
+    size_t BytesReserved;
+
+    void AllocateNewChunk(size_t MinSize);
+    void FreeChunks(FChunk* NewTopChunk);
+    static void ReleaseChunkList(FChunk* Chunk);
+};
+
+// 스코프 동안의 FMemStack 할당을 스코프 종료 시 되돌린다
+class FMemMark
+{
+public:
+    explicit FMemMark(FMemStack& InMem);
+    ~FMemMark();
+
+    FMemMark(const FMemMark&) = delete;
+    FMemMark& operator=(const FMemMark&) = delete;
+
+    void Pop();
+
+private:
+    FMemStack& Mem;
+    uint8* SavedTop;
+    FMemStack::FChunk* SavedChunk;
+    bool bPopped;
+};
+
+// FMemStack에서 메모리를 받는 STL 호환 할당자 (TArray의 아레나 변형에 사용)
+// 해제는 아무 일도 하지 않으므로 컨테이너는 FMemMark 스코프 안에서 생성하고 소멸시켜야 한다.
+template<typename T>
+class TMemStackAllocator
+{
+public:
+    using value_type = T;
+
+    TMemStackAllocator() = default;
+
+    template<typename U>
+    TMemStackAllocator(const TMemStackAllocator<U>&) {}
+
+    T* allocate(size_t Count)
+    {
+        return FMemStack::Get().Alloc<T>(Count);
+    }
+
+    void deallocate(T*, size_t) {}
+
+    template<typename U>
+    bool operator==(const TMemStackAllocator<U>&) const { return true; }
+
+    template<typename U>
+    bool operator!=(const TMemStackAllocator<U>&) const { return false; }
+};
@@ -1,21 +1,377 @@
 #include "pch.h"
 #include "Memory.h"
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <new>
 
-uint32 FMemory::TotalAllocationBytes = 0;
-uint32 FMemory::TotalAllocationCount = 0;
+namespace
+{
+    constexpr uint32 NumMemoryTags = static_cast<uint32>(EMemoryTag::Count);
+
+    // 스레드별 카운터 슬롯 수 (초과한 스레드는 공유 슬롯을 atomic RMW로 사용)
+    constexpr int32 MaxCounterSlots = 64;
+
+    // 모든 할당 앞에 붙는 헤더 (16바이트 유지)
+    struct FAllocationHeader
+    {
+        uint64 Size;
+        uint32 Offset;  // 원본 malloc 포인터로부터의 거리
+        uint8 Tag;
+        uint8 Padding[ 3 ];
+    };
+    static_assert(sizeof(FAllocationHeader) == FMemory::DEFAULT_ALIGNMENT, "FAllocationHeader must stay 16 bytes");
+
+    // 스레드 하나가 소유하는 카운터
+    // 소유 스레드만 쓰므로 relaxed load + store로 충분하다 (lock 접두어 없음).
+    // atomic 타입은 다른 스레드가 GetStats()에서 읽을 때의 data race를 막기 위함.
+    struct alignas(64) FThreadCounterSlot
+    {
+        std::atomic<int64> Bytes[ NumMemoryTags ];
+        std::atomic<int64> Count[ NumMemoryTags ];
+        std::atomic<uint64> Total[ NumMemoryTags ];
+    };
+
+    // 상수 초기화되는 정적 저장소라 operator new가 정적 초기화 중에 호출돼도 안전하다
+    FThreadCounterSlot CounterSlots[ MaxCounterSlots ];
+    FThreadCounterSlot SharedCounterSlot;
+    std::atomic<int32> NumClaimedSlots{ 0 };
+
+    thread_local FThreadCounterSlot* ThreadCounterSlot = nullptr;
+    thread_local EMemoryTag ThreadCurrentTag = EMemoryTag::Default;
+
+    FThreadCounterSlot* GetThreadCounterSlot()
+    {
+        if (!ThreadCounterSlot)
+        {
+            int32 SlotIndex = NumClaimedSlots.fetch_add(1, std::memory_order_relaxed);
+            ThreadCounterSlot = SlotIndex < MaxCounterSlots ? &CounterSlots[ SlotIndex ] : &SharedCounterSlot;
+        }
+        return ThreadCounterSlot;
+    }
+
+    template<typename T>
+    void AddCounter(std::atomic<T>& Counter, T Delta, bool bShared)
+    {
+        if (bShared)
+        {
+            Counter.fetch_add(Delta, std::memory_order_relaxed);
+        }
+        else
+        {
+            Counter.store(Counter.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+        }
+    }
+
+    void TrackAlloc(EMemoryTag Tag, uint64 Size)
+    {
+        FThreadCounterSlot* Slot = GetThreadCounterSlot();
+        bool bShared = Slot == &SharedCounterSlot;
+        uint32 TagIndex = static_cast<uint32>(Tag);
+
+        AddCounter<int64>(Slot->Bytes[ TagIndex ], static_cast<int64>(Size), bShared);
+        AddCounter<int64>(Slot->Count[ TagIndex ], 1, bShared);
+        AddCounter<uint64>(Slot->Total[ TagIndex ], 1, bShared);
+    }
+
+    void TrackFree(EMemoryTag Tag, uint64 Size)
+    {
+        // 해제는 할당한 스레드가 아니어도 되므로 슬롯 값이 음수가 될 수 있다 (합산 시 상쇄)
+        FThreadCounterSlot* Slot = GetThreadCounterSlot();
+        bool bShared = Slot == &SharedCounterSlot;
+        uint32 TagIndex = static_cast<uint32>(Tag);
+
+        AddCounter<int64>(Slot->Bytes[ TagIndex ], -static_cast<int64>(Size), bShared);
+        AddCounter<int64>(Slot->Count[ TagIndex ], -1, bShared);
+    }
+
+    void AccumulateSlot(const FThreadCounterSlot& Slot, FMemoryStats& OutStats)
+    {
+        for (uint32 i = 0; i < NumMemoryTags; ++i)
+        {
+            OutStats.Tags[ i ].AllocatedBytes += Slot.Bytes[ i ].load(std::memory_order_relaxed);
+            OutStats.Tags[ i ].AllocationCount += Slot.Count[ i ].load(std::memory_order_relaxed);
+            OutStats.Tags[ i ].TotalAllocations += Slot.Total[ i ].load(std::memory_order_relaxed);
+        }
+    }
+
+    FAllocationHeader* GetHeader(const void* Ptr)
+    {
+        return reinterpret_cast<FAllocationHeader*>(const_cast<uint8*>(static_cast<const uint8*>(Ptr)) - sizeof(FAllocationHeader));
+    }
+}
+
+int64 FMemoryStats::GetTotalAllocatedBytes() const
+{
+    int64 Total = 0;
+    for (const FMemoryTagStats& Tag : Tags)
+    {
+        Total += Tag.AllocatedBytes;
+    }
+    return Total;
+}
+
+int64 FMemoryStats::GetTotalAllocationCount() const
+{
+    int64 Total = 0;
+    for (const FMemoryTagStats& Tag : Tags)
+    {
+        Total += Tag.AllocationCount;
+    }
+    return Total;
+}
+
+uint64 FMemoryStats::GetTotalAllocations() const
+{
+    uint64 Total = 0;
+    for (const FMemoryTagStats& Tag : Tags)
+    {
+        Total += Tag.TotalAllocations;
+    }
+    return Total;
+}
+
+void* FMemory::Malloc(size_t Size, size_t Alignment, EMemoryTag Tag)
+{
+    if (Alignment < DEFAULT_ALIGNMENT)
+    {
+        Alignment = DEFAULT_ALIGNMENT;
+    }
+
+    // 헤더 + 정렬 여유분을 함께 할당 (합이 size_t를 넘치면 작은 블록을 받게 되므로 실패 처리)
+    if (Size > SIZE_MAX - Alignment - sizeof(FAllocationHeader))
+    {
+        return nullptr;
+    }
+
+    uint8* RawPtr = static_cast<uint8*>(std::malloc(Size + Alignment + sizeof(FAllocationHeader)));
+    if (!RawPtr)
+    {
+        return nullptr;
+    }
+
+    uintptr_t UserAddress = reinterpret_cast<uintptr_t>(RawPtr) + sizeof(FAllocationHeader);
+    UserAddress = (UserAddress + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+    uint8* UserPtr = reinterpret_cast<uint8*>(UserAddress);
+
+    FAllocationHeader* Header = GetHeader(UserPtr);
+    Header->Size = Size;
+    Header->Offset = static_cast<uint32>(UserPtr - RawPtr);
+    Header->Tag = static_cast<uint8>(Tag);
+
+    TrackAlloc(Tag, Size);
+    return UserPtr;
+}
+
+void* FMemory::Realloc(void* Ptr, size_t NewSize, size_t Alignment)
+{
+    if (!Ptr)
+    {
+        return Malloc(NewSize, Alignment);
+    }
+
+    if (NewSize == 0)
+    {
+        Free(Ptr);
+        return nullptr;
+    }
+
+    FAllocationHeader* OldHeader = GetHeader(Ptr);
+    void* NewPtr = Malloc(NewSize, Alignment, static_cast<EMemoryTag>(OldHeader->Tag));
+    if (NewPtr)
+    {
+        std::memcpy(NewPtr, Ptr, OldHeader->Size < NewSize ? OldHeader->Size : NewSize);
+        Free(Ptr);
+    }
+    return NewPtr;
+}
+
+void FMemory::Free(void* Ptr)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+    FAllocationHeader* Header = GetHeader(Ptr);
+    TrackFree(static_cast<EMemoryTag>(Header->Tag), Header->Size);
+    std::free(static_cast<uint8*>(Ptr) - Header->Offset);
+}
+
+void* FMemory::AllocPages(size_t Size, EMemoryTag Tag)
+{
+    // Windows의 VirtualAlloc은 할당 단위(64KB)로 정렬된 주소를 돌려준다
+#ifdef _WIN32
+    void* Ptr = VirtualAlloc(nullptr, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    Size = (Size + PAGE_ALLOCATION_ALIGNMENT - 1) & ~(PAGE_ALLOCATION_ALIGNMENT - 1);
+    void* Ptr = std::aligned_alloc(PAGE_ALLOCATION_ALIGNMENT, Size);
+#endif
+    if (Ptr)
+    {
+        TrackAlloc(Tag, Size);
+    }
+    return Ptr;
+}
+
+void FMemory::FreePages(void* Ptr, size_t Size, EMemoryTag Tag)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    VirtualFree(Ptr, 0, MEM_RELEASE);
+#else
+    Size = (Size + PAGE_ALLOCATION_ALIGNMENT - 1) & ~(PAGE_ALLOCATION_ALIGNMENT - 1);
+    std::free(Ptr);
+#endif
+    TrackFree(Tag, Size);
+}
+
+size_t FMemory::GetAllocSize(const void* Ptr)
+{
+    return Ptr ? static_cast<size_t>(GetHeader(Ptr)->Size) : 0;
+}
+
+EMemoryTag FMemory::GetAllocTag(const void* Ptr)
+{
+    return Ptr ? static_cast<EMemoryTag>(GetHeader(Ptr)->Tag) : EMemoryTag::Default;
+}
+
+EMemoryTag FMemory::GetCurrentTag()
+{
+    return ThreadCurrentTag;
+}
+
+void FMemory::SetCurrentTag(EMemoryTag Tag)
+{
+    ThreadCurrentTag = Tag;
+}
+
+FMemoryStats FMemory::GetStats()
+{
+    FMemoryStats Stats;
+
+    int32 NumSlots = NumClaimedSlots.load(std::memory_order_relaxed);
+    if (NumSlots > MaxCounterSlots)
+    {
+        NumSlots = MaxCounterSlots;
+    }
+
+    for (int32 i = 0; i < NumSlots; ++i)
+    {
+        AccumulateSlot(CounterSlots[ i ], Stats);
+    }
+    AccumulateSlot(SharedCounterSlot, Stats);
+
+    return Stats;
+}
+
+const char* FMemory::GetTagName(EMemoryTag Tag)
+{
+    switch (Tag)
+    {
+    case EMemoryTag::Default:    return "Default";
+    case EMemoryTag::UObject:    return "UObject";
+    case EMemoryTag::MeshData:   return "MeshData";
+    case EMemoryTag::Names:      return "Names";
+    case EMemoryTag::Containers: return "Containers";
+    default:                     return "Unknown";
+    }
+}
+
+#if MEMORY_OVERRIDE_GLOBAL_NEW
+// 전역 new/delete는 현재 스레드 태그로 FMemory를 거친다
+void* operator new(size_t Size)
+{
+    void* Ptr = FMemory::Malloc(Size, FMemory::DEFAULT_ALIGNMENT, FMemory::GetCurrentTag());
+    if (!Ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return Ptr;
+}
+
+void* operator new[](size_t Size)
+{
+    return operator new(Size);
+}
+
+void* operator new(size_t Size, const std::nothrow_t&) noexcept
+{
+    return FMemory::Malloc(Size, FMemory::DEFAULT_ALIGNMENT, FMemory::GetCurrentTag());
+}
+
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept
+{
+    return FMemory::Malloc(Size, FMemory::DEFAULT_ALIGNMENT, FMemory::GetCurrentTag());
+}
+
+void* operator new(size_t Size, std::align_val_t Alignment)
+{
+    void* Ptr = FMemory::Malloc(Size, static_cast<size_t>(Alignment), FMemory::GetCurrentTag());
+    if (!Ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return Ptr;
+}
+
+void* operator new[](size_t Size, std::align_val_t Alignment)
+{
+    return operator new(Size, Alignment);
+}
+
+void operator delete(void* Ptr) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete[](void* Ptr) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete(void* Ptr, size_t) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete[](void* Ptr, size_t) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete(void* Ptr, std::align_val_t) noexcept
+{
+    FMemory::Free(Ptr);
+}
+
+void operator delete[](void* Ptr, std::align_val_t) noexcept
+{
+    FMemory::Free(Ptr);
+}
 
-void* operator new(size_t size)
+void operator delete(void* Ptr, size_t, std::align_val_t) noexcept
 {
-    void* ptr = std::malloc(size);
-    FMemory::TotalAllocationBytes += static_cast<uint32>(size);
-    FMemory::TotalAllocationCount++;
-    return ptr;
+    FMemory::Free(Ptr);
 }
 
-void operator delete(void* ptr, size_t size) noexcept
+void operator delete[](void* Ptr, size_t, std::align_val_t) noexcept
 {
-    std::free(ptr);
-    FMemory::TotalAllocationBytes -= static_cast<uint32>(size);
-    FMemory::TotalAllocationCount--;
+    FMemory::Free(Ptr);
 }
+#endif
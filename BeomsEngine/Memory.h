@@ -1,8 +1,102 @@
 #pragma once
 #include "Types.h"
+#include <cstddef>
 
+// 1이면 전역 operator new/delete를 FMemory로 보내 STL 등 태그 없는 할당까지 현재 스레드 태그로 집계한다.
+// 기본값 0 - 프로세스 전체의 할당 경로를 바꾸지 않고, FMemory를 직접 호출하는 엔진 컨테이너/할당자만 집계된다.
+#ifndef MEMORY_OVERRIDE_GLOBAL_NEW
+#define MEMORY_OVERRIDE_GLOBAL_NEW 0
+#endif
+
+// 할당을 서브시스템별로 집계하기 위한 태그
+enum class EMemoryTag : uint8
+{
+    Default,
+    UObject,
+    MeshData,
+    Names,
+    Containers,
+
+    Count
+};
+
+// 태그 하나에 대한 할당 통계
+struct FMemoryTagStats
+{
+    int64 AllocatedBytes;   // 현재 살아있는 바이트 수
+    int64 AllocationCount;  // 현재 살아있는 할당 개수
+    uint64 TotalAllocations; // 누적 할당 횟수 (할당 압력 측정용)
+
+    FMemoryTagStats()
+        : AllocatedBytes(0)
+        , AllocationCount(0)
+        , TotalAllocations(0)
+    {}
+};
+
+// 모든 스레드의 카운터를 합친 스냅샷
+struct FMemoryStats
+{
+    FMemoryTagStats Tags[ static_cast<uint32>(EMemoryTag::Count) ];
+
+    const FMemoryTagStats& GetTag(EMemoryTag Tag) const { return Tags[ static_cast<uint32>(Tag) ]; }
+
+    int64 GetTotalAllocatedBytes() const;
+    int64 GetTotalAllocationCount() const;
+    uint64 GetTotalAllocations() const;
+};
+
+// 엔진 메모리 할당 계층
+// - 모든 할당 앞에 헤더를 두어 크기/태그를 기록한다.
+// - 카운터는 스레드별 슬롯에 기록하고 GetStats()에서 합산한다. (lock/RMW 없음)
 struct FMemory
 {
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+    static constexpr size_t DEFAULT_ALIGNMENT = 16;
+
+    static void* Malloc(size_t Size, size_t Alignment = DEFAULT_ALIGNMENT, EMemoryTag Tag = EMemoryTag::Default);
+    static void* Realloc(void* Ptr, size_t NewSize, size_t Alignment = DEFAULT_ALIGNMENT);
+    static void Free(void* Ptr);
+
+    // OS 페이지 단위 할당 (PAGE_ALLOCATION_ALIGNMENT 정렬, 헤더 없음)
+    // 슬랩/아레나처럼 큰 블록을 직접 관리하는 할당자에서 사용
+    static constexpr size_t PAGE_ALLOCATION_ALIGNMENT = 64 * 1024;
+    static void* AllocPages(size_t Size, EMemoryTag Tag);
+    static void FreePages(void* Ptr, size_t Size, EMemoryTag Tag);
+
+    // Malloc으로 받은 블록의 요청 크기
+    static size_t GetAllocSize(const void* Ptr);
+    static EMemoryTag GetAllocTag(const void* Ptr);
+
+    // 현재 스레드에서 태그를 지정하지 않는 할당(TArray/TMap, MEMORY_OVERRIDE_GLOBAL_NEW일 때의 operator new)에 적용할 태그
+    static EMemoryTag GetCurrentTag();
+    static void SetCurrentTag(EMemoryTag Tag);
+
+    // 통계
+    static FMemoryStats GetStats();
+    static int64 GetTotalAllocationBytes() { return GetStats().GetTotalAllocatedBytes(); }
+    static int64 GetTotalAllocationCount() { return GetStats().GetTotalAllocationCount(); }
+
+    static const char* GetTagName(EMemoryTag Tag);
+};
+
+// 스코프 동안 현재 스레드의 기본 할당 태그를 바꾼다
+class FMemoryTagScope
+{
+public:
+    explicit FMemoryTagScope(EMemoryTag InTag)
+        : PreviousTag(FMemory::GetCurrentTag())
+    {
+        FMemory::SetCurrentTag(InTag);
+    }
+
+    ~FMemoryTagScope()
+    {
+        FMemory::SetCurrentTag(PreviousTag);
+    }
+
+    FMemoryTagScope(const FMemoryTagScope&) = delete;
+    FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+    EMemoryTag PreviousTag;
+};
@@ -4,6 +4,10 @@
 
 IMPLEMENT_CLASS(UMeshComponent, UPrimitiveComponent)
 
+BEGIN_PROPERTIES(UMeshComponent)
+    UPROPERTY_REGISTER(bWireframeMode, EPropertyFlags::Edit)
+END_PROPERTIES()
+
 UMeshComponent::UMeshComponent()
     : bWireframeMode(false)
     , CachedBoundingBoxMin(FVector::Zero)
@@ -104,7 +108,7 @@ float UMeshComponent::GetBoundingSphereRadius() const
     return CachedBoundingSphereRadius;
 }
 
-FBoxSphereBounds UMeshComponent::GetBounds() const
+FBoxSphereBounds UMeshComponent::GetLocalBounds() const
 {
     if (!bBoundingCacheValid)
     {
@@ -138,6 +142,8 @@ void UMeshComponent::UpdateRenderState()
 
 void UMeshComponent::InvalidateBounds()
 {
+    Super::InvalidateBounds();
+
     bBoundingCacheValid = false;
 }
 
@@ -6,6 +6,7 @@ class UMeshComponent : public UPrimitiveComponent
 {
     UCLASS()
     GENERATED_BODY(UMeshComponent, UPrimitiveComponent)
+    DECLARE_PROPERTIES()
 
 public:
     UMeshComponent();
@@ -29,11 +30,11 @@ public:
     class UMaterialInterface* GetMaterialOverride(int32 MaterialIndex) const;
     void ClearMaterialOverrides();
 
-    // 바운딩 관련
+    // 바운딩 관련 (로컬 공간)
     virtual FVector GetBoundingBoxMin() const override;
     virtual FVector GetBoundingBoxMax() const override;
     virtual float GetBoundingSphereRadius() const override;
-    virtual FBoxSphereBounds GetBounds() const override;
+    virtual FBoxSphereBounds GetLocalBounds() const override;
 
     // 메시 데이터 접근 (하위 클래스에서 구현)
     virtual uint32 GetNumVertices() const { return 0; }
@@ -54,7 +55,7 @@ protected:
     // 메시 렌더링 플래그들
     bool bWireframeMode;
 
-    // 바운딩 캐시
+    // 로컬 바운딩 캐시
     mutable FVector CachedBoundingBoxMin;
     mutable FVector CachedBoundingBoxMax;
     mutable float CachedBoundingSphereRadius;
@@ -64,8 +65,8 @@ protected:
     virtual void MarkRenderStateDirty() override;
     virtual void UpdateRenderState() override;
 
-    // 바운딩 캐시 무효화
-    virtual void InvalidateBounds();
+    // 바운딩 캐시 무효화 (월드 바운딩 캐시도 함께)
+    virtual void InvalidateBounds() override;
     virtual void UpdateBounds() const;
 
     // 머티리얼 유틸리티
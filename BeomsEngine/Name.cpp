@@ -1,8 +1,284 @@
 #include "pch.h"
 #include "Name.h"
 
-// FNamePool 싱글톤 인스턴스 정의
-FNamePool* FNamePool::Instance = nullptr;
+namespace
+{
+    constexpr uint32 InitialSlotCount = 256;
+}
+
+void FNamePool::FNameSlotTable::Grow()
+{
+    const uint32 NewCount = Slots.empty() ? InitialSlotCount : static_cast<uint32>(Slots.size()) * 2;
+    TArray<FNameSlot> OldSlots(NewCount, FNameSlot{ NAME_None, 0 });
+    OldSlots.swap(Slots);
+
+    // 저장된 해시로 재배치하므로 문자열을 다시 읽지 않는다
+    const uint32 Mask = NewCount - 1;
+    for (const FNameSlot& Slot : OldSlots)
+    {
+        if (Slot.Id != NAME_None)
+        {
+            uint32 Index = Slot.Hash & Mask;
+            while (Slots[Index].Id != NAME_None)
+            {
+                Index = (Index + 1) & Mask;
+            }
+            Slots[Index] = Slot;
+        }
+    }
+}
+
+FNamePool::FNamePool()
+    : Cursor(0)
+    , NumEntries(0)
+    , NumBlocks(0)
+{
+    for (std::atomic<uint8*>& Block : Blocks)
+    {
+        Block.store(nullptr, std::memory_order_relaxed);
+    }
+
+    for (FNamePoolShard& Shard : Shards)
+    {
+        Shard.ComparisonIds.Grow();
+        Shard.DisplayIds.Grow();
+    }
+
+    // NAME_None (빈 문자열)은 첫 블록의 첫 엔트리 = ID 0
+    // 빈 문자열은 Store가 바로 NAME_None을 반환하므로 검색 테이블에는 넣지 않는다
+    CreateEntry("", 0, HashNameLowerCase("", 0));
+}
+
+FNamePool& FNamePool::GetInstance()
+{
+    // FName 전역 상수들이 정적 초기화 중에 접근하므로 함수 내 정적 변수로 생성 순서를 보장한다
+    // 종료 시점에도 다른 전역 소멸자가 이름을 읽을 수 있어 해제하지 않는다
+    static FNamePool* Instance = new FNamePool();
+    return *Instance;
+}
+
+uint8* FNamePool::GetOrCreateBlock(uint32 BlockIndex)
+{
+    assert(BlockIndex < MaxBlocks && "FNamePool is full");
+
+    uint8* Block = Blocks[BlockIndex].load(std::memory_order_acquire);
+    if (!Block)
+    {
+        // 블록 경계를 넘은 여러 샤드가 동시에 올 수 있으므로 CAS로 한 번만 게시한다
+        uint8* NewBlock = static_cast<uint8*>(FMemory::AllocPages(BlockSize, EMemoryTag::Names));
+        if (Blocks[BlockIndex].compare_exchange_strong(Block, NewBlock, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            Block = NewBlock;
+            NumBlocks.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            FMemory::FreePages(NewBlock, BlockSize, EMemoryTag::Names);
+        }
+    }
+    return Block;
+}
+
+FNameEntryId FNamePool::CreateEntry(const char* Str, uint32 Len, uint32 Hash)
+{
+    const uint32 EntrySize = (FNameEntry::GetHeaderSize() + Len + 1 + EntryStride - 1) & ~(EntryStride - 1);
+
+    // 블록 커서를 CAS로 전진시켜 공간 예약 - 샤드가 달라도 같은 블록을 빈틈없이 채운다
+    uint64 Current = Cursor.load(std::memory_order_relaxed);
+    uint32 BlockIndex = 0;
+    uint32 Offset = 0;
+    for (;;)
+    {
+        BlockIndex = static_cast<uint32>(Current >> 32);
+        Offset = static_cast<uint32>(Current);
+
+        if (Offset + EntrySize > BlockSize)
+        {
+            ++BlockIndex;
+            Offset = 0;
+        }
+
+        const uint64 Next = (static_cast<uint64>(BlockIndex) << 32) | (Offset + EntrySize);
+        if (Cursor.compare_exchange_weak(Current, Next, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    uint8* Block = GetOrCreateBlock(BlockIndex);
+    FNameEntry* Entry = reinterpret_cast<FNameEntry*>(Block + Offset);
+    Entry->Hash = Hash;
+    Entry->Len = static_cast<uint16>(Len);
+    memcpy(Entry->Data, Str, Len);
+    Entry->Data[Len] = '\0';
+
+    NumEntries.fetch_add(1, std::memory_order_relaxed);
+
+    // ID는 샤드 잠금을 푼 뒤에야 다른 스레드로 전달되므로 엔트리 기록이 먼저 보인다
+    return (BlockIndex << BlockOffsetBits) | (Offset / EntryStride);
+}
+
+bool FNamePool::EqualsIgnoreCase(const FNameEntry& Entry, const char* Str, uint32 Len)
+{
+    if (Entry.Len != Len)
+    {
+        return false;
+    }
+
+    for (uint32 i = 0; i < Len; ++i)
+    {
+        if (ToLowerAscii(Entry.Data[i]) != ToLowerAscii(Str[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FNamePool::EqualsCaseSensitive(const FNameEntry& Entry, const char* Str, uint32 Len)
+{
+    return Entry.Len == Len && memcmp(Entry.Data, Str, Len) == 0;
+}
+
+template<typename EqualsType>
+FNameEntryId FNamePool::Probe(FNameSlotTable& Table, uint32 Hash, EqualsType Equals, uint32& OutSlot) const
+{
+    const uint32 Mask = static_cast<uint32>(Table.Slots.size()) - 1;
+    uint32 Index = Hash & Mask;
+    for (;;)
+    {
+        const FNameSlot& Slot = Table.Slots[Index];
+        if (Slot.Id == NAME_None)
+        {
+            OutSlot = Index;
+            return NAME_None;
+        }
+
+        // 해시가 같을 때만 엔트리 문자열과 비교
+        if (Slot.Hash == Hash && Equals(*GetEntry(Slot.Id)))
+        {
+            OutSlot = Index;
+            return Slot.Id;
+        }
+
+        Index = (Index + 1) & Mask;
+    }
+}
+
+std::pair<FNameEntryId, FNameDisplayIndex> FNamePool::Store(const char* Str, uint32 Len, uint32 Hash)
+{
+    if (Len == 0)
+    {
+        return std::make_pair(NAME_None, NAME_None);
+    }
+
+    assert(Len <= MaxNameLength && "FName is too long");
+
+    FMemoryTagScope MemoryTagScope(EMemoryTag::Names);
+
+    // 대소문자 무시 해시 한 번으로 샤드 선택과 두 테이블 탐색을 모두 처리한다
+    assert(Hash == HashNameLowerCase(Str, Len));
+    FNamePoolShard& Shard = Shards[Hash >> (32 - ShardBits)];
+
+    std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+    uint32 SlotIndex = 0;
+    const FNameEntryId ComparisonId = Probe(Shard.ComparisonIds, Hash,
+        [Str, Len](const FNameEntry& Entry) { return EqualsIgnoreCase(Entry, Str, Len); }, SlotIndex);
+
+    if (ComparisonId == NAME_None)
+    {
+        // 완전히 새로운 엔트리 - 비교용과 표시용을 겸한다
+        const FNameEntryId NewId = CreateEntry(Str, Len, Hash);
+        Shard.ComparisonIds.Slots[SlotIndex] = FNameSlot{ NewId, Hash };
+        if (++Shard.ComparisonIds.NumUsed * 2 > Shard.ComparisonIds.Slots.size())
+        {
+            Shard.ComparisonIds.Grow();
+        }
+        return std::make_pair(NewId, NAME_None);
+    }
+
+    if (EqualsCaseSensitive(*GetEntry(ComparisonId), Str, Len))
+    {
+        return std::make_pair(ComparisonId, NAME_None);
+    }
+
+    // 대소문자만 다른 변형
+    const FNameEntryId ExistingDisplayId = Probe(Shard.DisplayIds, Hash,
+        [Str, Len](const FNameEntry& Entry) { return EqualsCaseSensitive(Entry, Str, Len); }, SlotIndex);
+
+    if (ExistingDisplayId != NAME_None)
+    {
+        return std::make_pair(ComparisonId, ExistingDisplayId);
+    }
+
+    const FNameEntryId DisplayId = CreateEntry(Str, Len, Hash);
+    Shard.DisplayIds.Slots[SlotIndex] = FNameSlot{ DisplayId, Hash };
+    if (++Shard.DisplayIds.NumUsed * 2 > Shard.DisplayIds.Slots.size())
+    {
+        Shard.DisplayIds.Grow();
+    }
+    return std::make_pair(ComparisonId, DisplayId);
+}
+
+size_t FNamePool::GetMemoryUsage() const
+{
+    size_t TotalSize = static_cast<size_t>(NumBlocks.load(std::memory_order_relaxed)) * BlockSize;
+
+    for (const FNamePoolShard& Shard : Shards)
+    {
+        std::lock_guard<std::mutex> Lock(Shard.Mutex);
+        TotalSize += Shard.ComparisonIds.Slots.capacity() * sizeof(FNameSlot);
+        TotalSize += Shard.DisplayIds.Slots.capacity() * sizeof(FNameSlot);
+    }
+    return TotalSize;
+}
+
+void FName::Init(const char* InName, uint32 Len)
+{
+    int32 ExternalNumber = -1;
+    Len = ParseNameNumber(InName, Len, ExternalNumber);
+    Number = ExternalNumber < 0 ? NAME_NO_NUMBER_INTERNAL : NAME_EXTERNAL_TO_INTERNAL(ExternalNumber);
+
+    auto Result = FNamePool::GetInstance().Store(InName, Len);
+    ComparisonIndex = Result.first;
+    DisplayIndex = Result.second;
+}
+
+FString FName::ToString() const
+{
+    const FNameEntry& Entry = FNamePool::GetInstance().Resolve(ComparisonIndex, DisplayIndex);
+    if (Number == NAME_NO_NUMBER_INTERNAL)
+    {
+        return Entry.ToString();
+    }
+
+    FString Result;
+    Result.reserve(Entry.GetLength() + 11);
+    Result.append(Entry.GetData(), Entry.GetLength());
+    Result += '_';
+    Result += std::to_string(NAME_INTERNAL_TO_EXTERNAL(Number));
+    return Result;
+}
+
+const char* FName::ToConstCharPointer() const
+{
+    if (Number == NAME_NO_NUMBER_INTERNAL)
+    {
+        return FNamePool::GetInstance().Resolve(ComparisonIndex, DisplayIndex).GetData();
+    }
+
+    thread_local FString Buffer;
+    Buffer = ToString();
+    return Buffer.c_str();
+}
+
+FString FName::ToComparisonString() const
+{
+    FString Result = ToString();
+    std::transform(Result.begin(), Result.end(), Result.begin(), ToLowerAscii);
+    return Result;
+}
 
 // 상수 정의
 const FName FName::None = FName();
@@ -11,38 +287,41 @@ const FName FName::None = FName();
 namespace EName
 {
     // 게임 오브젝트 관련
-    const FName None = FName();
-    const FName Default = FName("Default");
-    const FName Root = FName("Root");
-    const FName World = FName("World");
+    constinit const FLazyName None("");
+    constinit const FLazyName Default("Default");
+    constinit const FLazyName Root("Root");
+    constinit const FLazyName World("World");
 
     // 컴포넌트 관련
-    const FName Transform = FName("Transform");
-    const FName Mesh = FName("Mesh");
-    const FName Collision = FName("Collision");
-    const FName Physics = FName("Physics");
+    constinit const FLazyName Transform("Transform");
+    constinit const FLazyName Mesh("Mesh");
+    constinit const FLazyName Collision("Collision");
+    constinit const FLazyName Physics("Physics");
 
     // 머티리얼 관련
-    const FName Material = FName("Material");
-    const FName Texture = FName("Texture");
-    const FName BaseColor = FName("BaseColor");
-    const FName Normal = FName("Normal");
-    const FName Roughness = FName("Roughness");
-    const FName Metallic = FName("Metallic");
+    constinit const FLazyName Material("Material");
+    constinit const FLazyName Texture("Texture");
+    constinit const FLazyName BaseColor("BaseColor");
+    constinit const FLazyName Normal("Normal");
+    constinit const FLazyName Roughness("Roughness");
+    constinit const FLazyName Metallic("Metallic");
+    constinit const FLazyName Specular("Specular");
+    constinit const FLazyName Opacity("Opacity");
+    constinit const FLazyName EmissiveColor("EmissiveColor");
 
     // 애니메이션 관련
-    const FName Bone = FName("Bone");
-    const FName Socket = FName("Socket");
-    const FName Animation = FName("Animation");
+    constinit const FLazyName Bone("Bone");
+    constinit const FLazyName Socket("Socket");
+    constinit const FLazyName Animation("Animation");
 
     // 이벤트 관련
-    const FName BeginPlay = FName("BeginPlay");
-    const FName EndPlay = FName("EndPlay");
-    const FName Tick = FName("Tick");
-    const FName Update = FName("Update");
+    constinit const FLazyName BeginPlay("BeginPlay");
+    constinit const FLazyName EndPlay("EndPlay");
+    constinit const FLazyName Tick("Tick");
+    constinit const FLazyName Update("Update");
 
     // 입력 관련
-    const FName Input = FName("Input");
-    const FName Action = FName("Action");
-    const FName Axis = FName("Axis");
+    constinit const FLazyName Input("Input");
+    constinit const FLazyName Action("Action");
+    constinit const FLazyName Axis("Axis");
 }
\ No newline at end of file
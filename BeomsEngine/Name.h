@@ -1,5 +1,8 @@
 #pragma once
 #include <cctype>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
 
 // FName의 내부 표현을 위한 타입들
 using FNameEntryId = uint32;
@@ -8,203 +11,274 @@ using FNameDisplayIndex = uint32;
 // 유효하지 않은 FName을 나타내는 상수
 constexpr FNameEntryId NAME_None = 0;
 
-struct FNameEntry
+// ASCII 소문자 변환 (로캘 무관)
+constexpr char ToLowerAscii(char C)
 {
-    FString ComparisonString;  // 소문자로 저장된 비교용 문자열
-    TArray<FString> DisplayVariations;  // 원본 대소문자 변형들
+    return (C >= 'A' && C <= 'Z') ? static_cast<char>(C + ('a' - 'A')) : C;
+}
 
-    FNameEntry() = default;
-    FNameEntry(const FString& InComparison, const FString& InDisplay)
-        : ComparisonString(InComparison)
+// 대소문자 무시 FNV-1a 해시 - 소문자 복사본을 만들지 않고 한 번에 계산한다
+constexpr uint32 HashNameLowerCase(const char* Str, uint32 Len)
+{
+    uint32 Hash = 2166136261u;
+    for (uint32 i = 0; i < Len; ++i)
     {
-        DisplayVariations.push_back(InDisplay);
+        Hash ^= static_cast<uint8>(ToLowerAscii(Str[i]));
+        Hash *= 16777619u;
     }
-};
+    return Hash;
+}
 
-class FNamePool
+// "Base_123" 형태의 번호 접미사 분리 - 기본 이름 길이를 반환하고 번호(외부 표현)를 OutNumber에 기록
+// 번호가 없으면 Len을 그대로 반환하고 OutNumber는 -1 ("_0"이 아닌 0으로 시작하는 숫자는 원문 보존을 위해 분리하지 않음)
+constexpr uint32 ParseNameNumber(const char* Str, uint32 Len, int32& OutNumber)
 {
-private:
-    // FName 엔트리들 (인덱스 = FNameEntryId)
-    TArray<FNameEntry> NameEntries;
-
-    // 소문자 문자열 -> 인덱스 매핑을 위한 해시맵
-    std::unordered_map<FString, FNameEntryId> StringToIdMap;
+    OutNumber = -1;
 
-    // 다음 할당할 ID
-    FNameEntryId NextId;
+    uint32 NumDigits = 0;
+    while (NumDigits < Len && Str[Len - 1 - NumDigits] >= '0' && Str[Len - 1 - NumDigits] <= '9')
+    {
+        ++NumDigits;
+    }
 
-    // 싱글톤 인스턴스
-    static FNamePool* Instance;
+    if (NumDigits == 0 || NumDigits > 9 || NumDigits + 1 >= Len)
+    {
+        return Len;
+    }
 
-    FNamePool()
-        : NextId(1) // 0은 NAME_None으로 예약
+    const uint32 UnderscoreIndex = Len - NumDigits - 1;
+    if (Str[UnderscoreIndex] != '_' || (NumDigits > 1 && Str[UnderscoreIndex + 1] == '0'))
     {
-        // NAME_None (빈 문자열) 추가
-        NameEntries.push_back(FNameEntry("", ""));
-        StringToIdMap[""] = NAME_None;
+        return Len;
     }
 
-    // 문자열을 소문자로 변환하는 헬퍼 함수
-    static FString ToLowerCase(const FString& InString)
+    int32 Number = 0;
+    for (uint32 i = UnderscoreIndex + 1; i < Len; ++i)
     {
-        FString Result = InString;
-        std::transform(Result.begin(), Result.end(), Result.begin(), ::tolower);
-        return Result;
+        Number = Number * 10 + (Str[i] - '0');
     }
 
+    OutNumber = Number;
+    return UnderscoreIndex;
+}
+
+// 이름 엔트리 - 문자열 블록 안에 [해시, 길이, 문자들, '\0'] 형태로 연속 저장된다
+// 한 번 게시되면 수정되지도, 이동하지도 않는다.
+// 대소문자 변형은 각각 별도 엔트리로 저장되고 FName의 DisplayIndex가 그 엔트리를 가리킨다.
+struct FNameEntry
+{
+    uint32 Hash;    // 대소문자 무시 해시
+    uint16 Len;     // 문자 수 ('\0' 제외)
+    char Data[2];   // 실제로는 Len + 1 바이트가 이어진다
+
+    const char* GetData() const { return Data; }
+    uint32 GetLength() const { return Len; }
+    uint32 GetHash() const { return Hash; }
+
+    FString ToString() const { return FString(Data, Len); }
+
+    // 문자 데이터 앞의 헤더 크기
+    static constexpr uint32 GetHeaderSize() { return static_cast<uint32>(offsetof(FNameEntry, Data)); }
+};
+
+// 전역 이름 테이블
+// - 엔트리는 고정 크기 문자열 블록에 빈틈없이 저장되고 ID는 (블록, 오프셋)을 인코딩한다.
+//   블록은 이동하지 않으므로 Resolve는 잠금 없이(wait-free) 동작한다.
+// - 문자열 -> ID 검색 테이블은 해시 상위 비트로 샤드를 나누고, 삽입 시 해당 샤드만 잠근다.
+class FNamePool
+{
 public:
-    // 싱글톤 인스턴스 얻기
-    static FNamePool& GetInstance()
+    static constexpr uint32 EntryStride = alignof(FNameEntry);
+    static constexpr uint32 BlockOffsetBits = 16;
+    static constexpr uint32 BlockSize = EntryStride << BlockOffsetBits;
+    static constexpr uint32 MaxBlocks = 1024;
+    static constexpr uint32 ShardBits = 4;
+    static constexpr uint32 NumShards = 1u << ShardBits;
+    static constexpr uint32 MaxNameLength = 0xFFFF;
+
+private:
+    // 검색 테이블 슬롯 - 해시를 같이 저장해 문자열 비교와 재해시를 피한다
+    struct FNameSlot
     {
-        if (!Instance)
-        {
-            Instance = new FNamePool();
-        }
-        return *Instance;
-    }
+        FNameEntryId Id;    // NAME_None이면 빈 슬롯
+        uint32 Hash;
+    };
 
-    // 싱글톤 인스턴스 해제
-	static void DistroyInstance()
-	{
-		if (Instance)
-		{
-			delete Instance;
-			Instance = nullptr;
-		}
-	}
-
-    // 문자열을 FName ID와 DisplayIndex로 변환 (없으면 새로 생성)
-    std::pair<FNameEntryId, FNameDisplayIndex> Store(const FString& InString)
+    // 선형 탐사 오픈 어드레싱 테이블 (샤드 잠금 아래에서만 접근)
+    struct FNameSlotTable
+    {
+        TArray<FNameSlot> Slots;
+        uint32 NumUsed = 0;
+
+        void Grow();
+    };
+
+    // 샤드별 검색 테이블 (샤드끼리 캐시 라인을 공유하지 않도록 정렬)
+    struct alignas(64) FNamePoolShard
     {
-        // 대소문자 무시를 위해 소문자로 변환하여 검색
-        FString LowerCaseString = ToLowerCase(InString);
+        mutable std::mutex Mutex;
+
+        // 대소문자 무시 비교 -> 비교용 엔트리 (처음 저장된 대소문자 변형)
+        FNameSlotTable ComparisonIds;
+
+        // 대소문자 구분 비교 -> 표시용 엔트리 (비교용 엔트리와 대소문자가 다른 변형만)
+        FNameSlotTable DisplayIds;
+    };
+
+    // 문자열 블록 포인터 - 블록은 한 번 게시되면 해제되지 않는다
+    std::atomic<uint8*> Blocks[MaxBlocks];
+
+    // 다음 엔트리 위치 (상위 32비트 = 블록, 하위 32비트 = 블록 내 바이트 오프셋)
+    std::atomic<uint64> Cursor;
+
+    std::atomic<uint32> NumEntries;
+    std::atomic<uint32> NumBlocks;
+
+    FNamePoolShard Shards[NumShards];
+
+    FNamePool();
+
+    // 블록에 공간을 예약하고 엔트리를 기록한 뒤 ID 반환 (호출자는 해당 샤드의 잠금을 잡고 있어야 한다)
+    FNameEntryId CreateEntry(const char* Str, uint32 Len, uint32 Hash);
 
-        // 이미 존재하는지 확인 (소문자로)
-        auto It = StringToIdMap.find(LowerCaseString);
-        if (It != StringToIdMap.end())
+    uint8* GetOrCreateBlock(uint32 BlockIndex);
+
+    const FNameEntry* GetEntry(FNameEntryId Id) const
+    {
+        const uint32 BlockIndex = Id >> BlockOffsetBits;
+        if (BlockIndex >= MaxBlocks)
         {
-            FNameEntryId ExistingId = It->second;
-            FNameEntry& Entry = NameEntries[ExistingId];
-
-            // 기존 Display 변형들에서 정확히 일치하는 것 찾기
-            for (size_t i = 0; i < Entry.DisplayVariations.size(); ++i)
-            {
-                if (Entry.DisplayVariations[i] == InString)
-                {
-                    return std::make_pair(ExistingId, static_cast<FNameDisplayIndex>(i));
-                }
-            }
-
-            // 새로운 Display 변형 추가
-            Entry.DisplayVariations.push_back(InString);
-            return std::make_pair(ExistingId, static_cast<FNameDisplayIndex>(Entry.DisplayVariations.size() - 1));
+            return nullptr;
         }
 
-        // 완전히 새로운 엔트리 생성
-        FNameEntryId NewId = NextId++;
-        NameEntries.push_back(FNameEntry(LowerCaseString, InString));
-        StringToIdMap[LowerCaseString] = NewId;
+        const uint8* Block = Blocks[BlockIndex].load(std::memory_order_acquire);
+        return Block ? reinterpret_cast<const FNameEntry*>(Block + (Id & ((1u << BlockOffsetBits) - 1)) * EntryStride) : nullptr;
+    }
+
+    // 테이블에서 Hash가 같고 Equals를 만족하는 엔트리 검색, 없으면 삽입 위치를 OutSlot에 돌려준다
+    template<typename EqualsType>
+    FNameEntryId Probe(FNameSlotTable& Table, uint32 Hash, EqualsType Equals, uint32& OutSlot) const;
+
+    static bool EqualsIgnoreCase(const FNameEntry& Entry, const char* Str, uint32 Len);
+    static bool EqualsCaseSensitive(const FNameEntry& Entry, const char* Str, uint32 Len);
+
+public:
+    FNamePool(const FNamePool&) = delete;
+    FNamePool& operator=(const FNamePool&) = delete;
+
+    // 싱글톤 인스턴스 얻기 (최초 호출 시 스레드 안전하게 생성되며 프로그램 종료까지 유지된다)
+    static FNamePool& GetInstance();
 
-        return std::make_pair(NewId, 0); // 첫 번째 변형이므로 DisplayIndex = 0
+    // 문자열을 FName ID와 DisplayIndex로 변환 (없으면 새로 생성) - 어느 스레드에서나 호출 가능
+    std::pair<FNameEntryId, FNameDisplayIndex> Store(const char* Str, uint32 Len)
+    {
+        return Store(Str, Len, HashNameLowerCase(Str, Len));
     }
 
-    // FName ID와 DisplayIndex를 문자열로 변환
-    const FString& Resolve(FNameEntryId Id, FNameDisplayIndex DisplayIndex = 0) const
+    // 해시를 미리 계산해 둔 경우 (FLazyName의 컴파일 타임 해시)
+    std::pair<FNameEntryId, FNameDisplayIndex> Store(const char* Str, uint32 Len, uint32 Hash);
+
+    std::pair<FNameEntryId, FNameDisplayIndex> Store(const FString& InString)
     {
-        if (Id < NameEntries.size())
-        {
-            const FNameEntry& Entry = NameEntries[Id];
-            if (DisplayIndex < Entry.DisplayVariations.size())
-            {
-                return Entry.DisplayVariations[DisplayIndex];
-            }
-            // DisplayIndex가 범위를 벗어나면 첫 번째 변형 반환
-            if (!Entry.DisplayVariations.empty())
-            {
-                return Entry.DisplayVariations[0];
-            }
-        }
+        return Store(InString.data(), static_cast<uint32>(InString.size()));
+    }
 
-        // 잘못된 ID인 경우 빈 문자열 반환
-        static const FString EmptyString = "";
-        return EmptyString;
+    // FName ID와 DisplayIndex를 엔트리로 변환 - 잠금 없음, 잘못된 ID는 NAME_None 엔트리
+    const FNameEntry& Resolve(FNameEntryId Id, FNameDisplayIndex DisplayIndex = NAME_None) const
+    {
+        const FNameEntry* Entry = GetEntry(DisplayIndex != NAME_None ? DisplayIndex : Id);
+        return Entry ? *Entry : *GetEntry(NAME_None);
     }
 
     // 비교용 문자열 반환 (소문자)
-    const FString& ResolveComparison(FNameEntryId Id) const
+    FString ResolveComparison(FNameEntryId Id) const
     {
-        if (Id < NameEntries.size())
-        {
-            return NameEntries[Id].ComparisonString;
-        }
-
-        static const FString EmptyString = "";
-        return EmptyString;
+        FString Result = Resolve(Id).ToString();
+        std::transform(Result.begin(), Result.end(), Result.begin(), ToLowerAscii);
+        return Result;
     }
 
     // 통계 정보
     size_t GetNumEntries() const
     {
-        return NameEntries.size();
+        return NumEntries.load(std::memory_order_relaxed);
     }
 
-    size_t GetMemoryUsage() const
-    {
-        size_t TotalSize = 0;
-        for (const auto& Entry : NameEntries)
-        {
-            TotalSize += Entry.ComparisonString.size();
-            for (const auto& DisplayVar : Entry.DisplayVariations)
-            {
-                TotalSize += DisplayVar.size();
-            }
-        }
-        return TotalSize;
-    }
+    // 문자열 블록과 검색 테이블이 실제로 차지하는 바이트 수
+    size_t GetMemoryUsage() const;
 };
 
+// FName 번호 접미사 (Base_N) 표현
+// 내부적으로는 외부 번호 + 1을 저장하며 0은 번호가 없음을 뜻한다.
+#define NAME_NO_NUMBER_INTERNAL 0
+#define NAME_EXTERNAL_TO_INTERNAL(x) ((x) + 1)
+#define NAME_INTERNAL_TO_EXTERNAL(x) ((x) - 1)
+
 class FName
 {
 private:
-    // 전역 문자열 테이블의 인덱스
+    // 전역 문자열 테이블의 인덱스 (번호 접미사를 뗀 기본 이름)
     FNameEntryId ComparisonIndex;
 
-    // 표시용 인덱스 (대소문자 구분, 번호 등)
+    // 표시용 엔트리 인덱스 (대소문자 구분, ComparisonIndex와 같은 엔트리면 NAME_None)
     FNameDisplayIndex DisplayIndex;
 
+    // 번호 접미사 (내부 표현, NAME_NO_NUMBER_INTERNAL이면 없음)
+    int32 Number;
+
+    // "Base_123" 형태면 접미사를 Number로 분리하고 기본 이름만 풀에 저장한다
+    void Init(const char* InName, uint32 Len);
+
+    friend class FLazyName;
+
+    FName(FNameEntryId InComparisonIndex, FNameDisplayIndex InDisplayIndex, int32 InNumber)
+        : ComparisonIndex(InComparisonIndex)
+        , DisplayIndex(InDisplayIndex)
+        , Number(InNumber)
+    {}
+
+    uint64 GetComparisonKey() const
+    {
+        return (static_cast<uint64>(ComparisonIndex) << 32) | static_cast<uint32>(Number);
+    }
+
 public:
     // 기본 생성자 (NAME_None)
     FName()
         : ComparisonIndex(NAME_None)
-        , DisplayIndex(0)
+        , DisplayIndex(NAME_None)
+        , Number(NAME_NO_NUMBER_INTERNAL)
     {}
 
     // 문자열로부터 생성
     explicit FName(const FString& InName)
     {
-        if (InName.empty())
-        {
-            ComparisonIndex = NAME_None;
-            DisplayIndex = 0;
-        }
-        else
-        {
-            // 전역 풀에 저장하고 ID와 DisplayIndex 받기
-            auto Result = FNamePool::GetInstance().Store(InName);
-            ComparisonIndex = Result.first;
-            DisplayIndex = Result.second;
-        }
+        Init(InName.data(), static_cast<uint32>(InName.size()));
     }
 
-    // C 스타일 문자열로부터 생성
+    // C 스타일 문자열로부터 생성 (임시 FString 없이 풀에 직접 전달)
     explicit FName(const char* InName)
-        : FName(FString(InName ? InName : ""))
+    {
+        Init(InName ? InName : "", InName ? static_cast<uint32>(strlen(InName)) : 0);
+    }
+
+    // 기본 이름 + 번호 (InNumber는 내부 표현 - NAME_EXTERNAL_TO_INTERNAL 사용)
+    // 문자열을 만들지 않으므로 대량 생성되는 이름도 풀에는 기본 이름 하나만 남는다
+    FName(const FName& BaseName, int32 InNumber)
+        : ComparisonIndex(BaseName.ComparisonIndex)
+        , DisplayIndex(BaseName.DisplayIndex)
+        , Number(InNumber)
+    {}
+
+    FName(const char* BaseName, int32 InNumber)
+        : FName(FName(BaseName), InNumber)
     {}
 
     // 복사 생성자
     FName(const FName& Other)
         : ComparisonIndex(Other.ComparisonIndex)
         , DisplayIndex(Other.DisplayIndex)
+        , Number(Other.Number)
     {}
 
     // 대입 연산자
@@ -212,67 +286,66 @@ public:
     {
         ComparisonIndex = Other.ComparisonIndex;
         DisplayIndex = Other.DisplayIndex;
+        Number = Other.Number;
         return *this;
     }
 
     // 비교 연산자들 (매우 빠름 - 정수 비교)
     bool operator==(const FName& Other) const
     {
-        return ComparisonIndex == Other.ComparisonIndex;
+        return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number;
     }
 
     bool operator!=(const FName& Other) const
     {
-        return ComparisonIndex != Other.ComparisonIndex;
+        return !(*this == Other);
     }
 
     bool operator<(const FName& Other) const
     {
-        return ComparisonIndex < Other.ComparisonIndex;
+        return GetComparisonKey() < Other.GetComparisonKey();
     }
 
     bool operator<=(const FName& Other) const
     {
-        return ComparisonIndex <= Other.ComparisonIndex;
+        return GetComparisonKey() <= Other.GetComparisonKey();
     }
 
     bool operator>(const FName& Other) const
     {
-        return ComparisonIndex > Other.ComparisonIndex;
+        return GetComparisonKey() > Other.GetComparisonKey();
     }
 
     bool operator>=(const FName& Other) const
     {
-        return ComparisonIndex >= Other.ComparisonIndex;
+        return GetComparisonKey() >= Other.GetComparisonKey();
     }
 
-    // 문자열 변환 (원본 대소문자 보존)
-    FString ToString() const
-    {
-        return FNamePool::GetInstance().Resolve(ComparisonIndex, DisplayIndex);
-    }
+    // 문자열 변환 (원본 대소문자 보존, 번호가 있으면 "_N" 접미사 포함)
+    FString ToString() const;
 
-    const char* ToConstCharPointer() const
+    // 번호가 없는 이름은 풀의 문자열을 그대로 반환한다 (엔트리는 이동하지 않음)
+    // 번호가 있는 이름은 스레드별 버퍼를 사용하므로 같은 스레드의 다음 호출 전까지만 유효하다
+    const char* ToConstCharPointer() const;
+
+    // 번호 접미사를 뗀 기본 이름 문자열
+    FString GetPlainNameString() const
     {
-        static FString CachedString = ToString();
-        return CachedString.c_str();
+        return FNamePool::GetInstance().Resolve(ComparisonIndex, DisplayIndex).ToString();
     }
 
     // 비교용 문자열 반환 (소문자)
-    FString ToComparisonString() const
-    {
-        return FNamePool::GetInstance().ResolveComparison(ComparisonIndex);
-    }
+    FString ToComparisonString() const;
 
     // 유효성 검사
     bool IsValid() const
     {
-        return ComparisonIndex != NAME_None;
+        return !IsNone();
     }
 
     bool IsNone() const
     {
-        return ComparisonIndex == NAME_None;
+        return ComparisonIndex == NAME_None && Number == NAME_NO_NUMBER_INTERNAL;
     }
 
     // 내부 ID 접근 (디버깅용)
@@ -286,16 +359,78 @@ public:
         return DisplayIndex;
     }
 
+    // 번호 접미사 (내부 표현)
+    int32 GetNumber() const
+    {
+        return Number;
+    }
+
+    void SetNumber(int32 InNumber)
+    {
+        Number = InNumber;
+    }
+
     // 해시 함수 (컨테이너에서 사용)
     size_t GetHash() const
     {
-        return static_cast<size_t>(ComparisonIndex);
+        return static_cast<size_t>(ComparisonIndex) + (static_cast<size_t>(Number) << 16) + static_cast<size_t>(Number);
     }
 
     // 정적 상수
     static const FName None;
 };
 
+// 컴파일 타임에 해시를 계산해 두고 처음 사용할 때 한 번만 풀에 등록되는 이름
+// - constinit 전역/정적 변수로 선언하면 정적 초기화 순서와 무관하게 어디서든 사용할 수 있다.
+// - 등록 이후의 변환은 원자적 로드 한 번이다.
+class FLazyName
+{
+public:
+    template<uint32 N>
+    constexpr FLazyName(const char (&InLiteral)[N])
+        : Literal(InLiteral)
+        , BaseLen(ParseNameNumber(InLiteral, N - 1, ExternalNumber))
+        , Hash(HashNameLowerCase(InLiteral, BaseLen))
+        , Indices(0)
+    {}
+
+    FLazyName(const FLazyName&) = delete;
+    FLazyName& operator=(const FLazyName&) = delete;
+
+    operator FName() const
+    {
+        return Resolve();
+    }
+
+    FName Resolve() const
+    {
+        uint64 Packed = Indices.load(std::memory_order_acquire);
+        if (Packed == 0)
+        {
+            // 여러 스레드가 동시에 등록해도 Store가 같은 결과를 돌려주므로 그대로 덮어쓴다
+            auto Result = FNamePool::GetInstance().Store(Literal, BaseLen, Hash);
+            Packed = (static_cast<uint64>(Result.first) << 32) | Result.second;
+            Indices.store(Packed, std::memory_order_release);
+        }
+
+        const int32 Number = ExternalNumber < 0 ? NAME_NO_NUMBER_INTERNAL : NAME_EXTERNAL_TO_INTERNAL(ExternalNumber);
+        return FName(static_cast<FNameEntryId>(Packed >> 32), static_cast<FNameDisplayIndex>(Packed), Number);
+    }
+
+private:
+    const char* Literal;
+    int32 ExternalNumber = -1;
+    uint32 BaseLen;
+    uint32 Hash;
+
+    // 등록된 (ComparisonIndex << 32 | DisplayIndex), 0이면 아직 미등록
+    mutable std::atomic<uint64> Indices;
+};
+
+// 문자열 리터럴을 FName으로 - 해시는 컴파일 타임에, 풀 등록은 최초 호출 시 한 번만 수행된다
+#define FNAME_LITERAL(Literal) \
+    ([]() -> FName { static constinit FLazyName LazyName(Literal); return LazyName; }())
+
 // 해시 함수 특수화 (std::unordered_map 등에서 사용)
 namespace std
 {
@@ -309,42 +444,45 @@ namespace std
     };
 }
 
-// 자주 사용될 것 같은 FName들을 미리 정의
+// 자주 사용될 것 같은 FName들을 미리 정의 (정적 초기화 순서와 무관하게 사용 가능)
 namespace EName
 {
     // 게임 오브젝트 관련
-    extern const FName None;
-    extern const FName Default;
-    extern const FName Root;
-    extern const FName World;
+    extern const FLazyName None;
+    extern const FLazyName Default;
+    extern const FLazyName Root;
+    extern const FLazyName World;
 
     // 컴포넌트 관련
-    extern const FName Transform;
-    extern const FName Mesh;
-    extern const FName Collision;
-    extern const FName Physics;
+    extern const FLazyName Transform;
+    extern const FLazyName Mesh;
+    extern const FLazyName Collision;
+    extern const FLazyName Physics;
 
     // 머티리얼 관련
-    extern const FName Material;
-    extern const FName Texture;
-    extern const FName BaseColor;
-    extern const FName Normal;
-    extern const FName Roughness;
-    extern const FName Metallic;
+    extern const FLazyName Material;
+    extern const FLazyName Texture;
+    extern const FLazyName BaseColor;
+    extern const FLazyName Normal;
+    extern const FLazyName Roughness;
+    extern const FLazyName Metallic;
+    extern const FLazyName Specular;
+    extern const FLazyName Opacity;
+    extern const FLazyName EmissiveColor;
 
     // 애니메이션 관련
-    extern const FName Bone;
-    extern const FName Socket;
-    extern const FName Animation;
+    extern const FLazyName Bone;
+    extern const FLazyName Socket;
+    extern const FLazyName Animation;
 
     // 이벤트 관련
-    extern const FName BeginPlay;
-    extern const FName EndPlay;
-    extern const FName Tick;
-    extern const FName Update;
+    extern const FLazyName BeginPlay;
+    extern const FLazyName EndPlay;
+    extern const FLazyName Tick;
+    extern const FLazyName Update;
 
     // 입력 관련
-    extern const FName Input;
-    extern const FName Action;
-    extern const FName Axis;
+    extern const FLazyName Input;
+    extern const FLazyName Action;
+    extern const FLazyName Axis;
 }
\ No newline at end of file
@@ -4,9 +4,10 @@
 #include "ObjectMacros.h"
 #include "UObjectArray.h"
 #include "ObjectInitializer.h"
+#include "UObjectAllocator.h"
 
 // 정적 멤버 초기화
-uint64 UObject::NextUniqueID = 1;
+std::atomic<uint64> UObject::NextUniqueID{ 1 };
 
 UObject::UObject()
     : bIsValid(true)
@@ -33,9 +34,75 @@ UObject::~UObject()
     bIsValid = false;
 }
 
+void* UObject::operator new(size_t Size)
+{
+    void* Ptr = GUObjectAllocator.Allocate(Size);
+    if (!Ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return Ptr;
+}
+
+void UObject::operator delete(void* Ptr, size_t Size)
+{
+    GUObjectAllocator.Free(Ptr, Size);
+}
+
+void UObject::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Collector.AddReferencedObject(Outer);
+}
+
+void UObject::SetOuter(UObject* InOuter)
+{
+    Outer = InOuter;
+    ReferenceWriteBarrier(InOuter);
+
+    // Outer를 떼면 최상위 오브젝트, 즉 루트가 되므로 루트 스캔이 지나간 뒤라면 AddToRoot처럼 회색으로 만든다
+    if (!InOuter)
+    {
+        GUObjectArray.WriteBarrier(nullptr, this);
+    }
+}
+
+void UObject::ReferenceWriteBarrier(UObject* Referenced)
+{
+    GUObjectArray.WriteBarrier(this, Referenced);
+}
+
+void UObject::AddToRoot()
+{
+    if (FUObjectItem* Item = GUObjectArray.GetObjectItemPtr(InternalIndex))
+    {
+        Item->SetFlags(EInternalObjectFlags::RootSet);
+
+        // 증분 마킹 중 루트 스캔이 이미 지나간 위치라면 여기서 회색으로 만든다
+        GUObjectArray.WriteBarrier(nullptr, this);
+    }
+}
+
+void UObject::RemoveFromRoot()
+{
+    if (FUObjectItem* Item = GUObjectArray.GetObjectItemPtr(InternalIndex))
+    {
+        Item->ClearFlags(EInternalObjectFlags::RootSet);
+    }
+}
+
+bool UObject::IsRooted() const
+{
+    const FUObjectItem* Item = GUObjectArray.GetObjectItemPtr(InternalIndex);
+    return Item && Item->HasAnyFlags(EInternalObjectFlags::RootSet);
+}
+
+BEGIN_PROPERTIES(UObject)
+    UPROPERTY_REGISTER(ObjectName, EPropertyFlags::Edit)
+END_PROPERTIES()
+
 uint64 UObject::GenerateUniqueID()
 {
-    return NextUniqueID++;
+    return NextUniqueID.fetch_add(1, std::memory_order_relaxed);
 }
 
 UClass* UObject::GetClass() const
@@ -45,34 +112,21 @@ UClass* UObject::GetClass() const
 
 UClass* UObject::GetStaticClass()
 {
-    static UClass* StaticClass = nullptr;
-    if (!StaticClass)
+    // 함수 지역 정적 변수 초기화는 스레드 안전하므로 여러 스레드가 처음 호출해도 한 번만 생성/등록된다
+    static UClass* StaticClass = []()
     {
-        StaticClass = new UClass(
-            FName("UObject"),
+        UClass* NewClass = new UClass(
+            FNAME_LITERAL("UObject"),
             nullptr,
             &UObject::CreateInstance
         );
-        UClass::RegisterClass(StaticClass);
-    }
+        UObject::StaticRegisterProperties(NewClass);
+        UClass::RegisterClass(NewClass);
+        return NewClass;
+    }();
     return StaticClass;
 }
 
-bool UObject::IsA(const UClass* SomeClass) const
-{
-    if (!SomeClass)
-        return false;
-        
-    UClass* MyClass = GetClass();
-    while (MyClass)
-    {
-        if (MyClass == SomeClass)
-            return true;
-        MyClass = MyClass->GetSuperClass();
-    }
-    return false;
-}
-
 bool UObject::IsA(const FString& ClassName) const
 {
     UClass* SomeClass = UClass::FindClass(FName(ClassName));
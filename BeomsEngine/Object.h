@@ -3,15 +3,17 @@
 #include "String.h"
 #include "Array.h"
 #include "Name.h"
+#include "Class.h"
 
 #ifdef GetClassName
 #undef GetClassName
 #endif
 
 // 전방 선언
-class UClass;
 class FUObjectArray;
 class FObjectInitializer;
+class FReferenceCollector;
+struct FProperty;
 
 // UObject 기본 클래스
 class UObject
@@ -37,24 +39,54 @@ public:
     virtual UClass* GetClass() const;
     static UClass* GetStaticClass();
     
-    // RTTI
-    bool IsA(const UClass* SomeClass) const;
+    // RTTI (UClass*를 받는 버전은 조상 배열 비교 한 번이므로 인라인)
+    bool IsA(const UClass* SomeClass) const { return GetClass()->IsChildOf(SomeClass); }
     bool IsA(const FString& ClassName) const;
     
     template<typename T>
     bool IsA() const;
     
     static UObject* CreateInstance() { return new UObject(); }
+
+    // 리플렉션 프로퍼티 등록 (Property.h의 DECLARE_PROPERTIES/BEGIN_PROPERTIES 참고)
+    static void StaticRegisterProperties(UClass* Class);
+
+    // 메모리 할당 - 모든 UObject 파생 클래스는 GUObjectAllocator의 크기 클래스 풀을 사용
+    static void* operator new(size_t Size);
+    static void operator delete(void* Ptr, size_t Size);
     
     // 소유자 관계
     UObject* GetOuter() const { return Outer; }
-    void SetOuter(UObject* InOuter) { Outer = InOuter; }
+    void SetOuter(UObject* InOuter);
     
     // 유효성 검사
     bool IsValid() const { return bIsValid && !bPendingKill; }
     void MarkPendingKill() { bPendingKill = true; }
     bool IsPendingKill() const { return bPendingKill; }
     
+    // GC
+    // 이 오브젝트가 참조하는 오브젝트들을 Collector에 보고한다 (기본 구현은 Outer)
+    virtual void AddReferencedObjects(FReferenceCollector& Collector);
+
+    // GC가 해제하기 직전에 호출 - 함께 해제될 오브젝트들이 아직 살아 있을 때 서로의 연결을 끊는다
+    virtual void BeginDestroy() {}
+
+    // 쓰기 배리어 - AddReferencedObjects로 보고하는 참조 필드에 Referenced를 대입한 뒤 호출
+    void ReferenceWriteBarrier(UObject* Referenced);
+
+    // 리플렉션
+    // setter를 거치지 않고 프로퍼티 메모리를 직접 바꾼 뒤 호출 - 그 값에서 파생된 상태(dirty 플래그 등)를 갱신한다
+    virtual void PostPropertyChanged(const FProperty& /*Property*/) {}
+
+    // 직렬화된 프로퍼티를 한꺼번에 복원한 뒤 호출 (UClass::DeserializePODProperties)
+    virtual void PostLoad() {}
+
+    // 루트 셋 - 다른 곳에서 참조되지 않아도 GC에서 해제되지 않는다
+    // Outer가 없는 최상위 오브젝트는 루트 셋에 넣지 않아도 루트로 취급된다 (PendingKill이 될 때까지 유지)
+    void AddToRoot();
+    void RemoveFromRoot();
+    bool IsRooted() const;
+
     // GUObjectArray 관리
     int32 GetInternalIndex() const { return InternalIndex; }
     void SetInternalIndex(int32 Index) { InternalIndex = Index; }
@@ -77,7 +109,7 @@ protected:
     static uint64 GenerateUniqueID();
     
 private:
-    static uint64 NextUniqueID;
+    static std::atomic<uint64> NextUniqueID;
 };
 
 template<typename T>
@@ -62,6 +62,7 @@ UObject* FObjectInitializer::CreateObject() const
     }
 
     // 클래스의 생성자를 통해 객체 생성
+    FMemoryTagScope MemoryTagScope(EMemoryTag::UObject);
     UObject* NewObject = ClassToUse->CreateDefaultObject();
     if (!NewObject)
     {
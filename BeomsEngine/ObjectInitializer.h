@@ -2,6 +2,7 @@
 #include "Types.h"
 #include "String.h"
 #include "Name.h"
+#include <atomic>
 
 // 전방 선언
 class UObject;
@@ -149,8 +150,11 @@ T* CreateDefaultSubobject(UObject* Outer)
         return nullptr;
     }
 
-    // 자동 이름 생성: 클래스명 + 고유 ID
-    FName AutoName = FName(FString("Default") + T::GetStaticClass()->GetNameString());
+    // 자동 이름 생성: "Default" + 클래스명을 한 번만 풀에 저장하고 고유 번호는 FName 번호 접미사로 붙인다
+    static const FName AutoBaseName(FString("Default") + T::GetStaticClass()->GetNameString());
+    // 워커 스레드에서도 NewObject를 호출할 수 있으므로 번호는 원자적으로 발급한다 (중복 이름 방지)
+    static std::atomic<int32> NextAutoNameNumber = 0;
+    FName AutoName(AutoBaseName, NAME_EXTERNAL_TO_INTERNAL(NextAutoNameNumber.fetch_add(1, std::memory_order_relaxed)));
 
     return CreateDefaultSubobject<T>(Outer, AutoName);
 }
\ No newline at end of file
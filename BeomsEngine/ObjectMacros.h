@@ -20,45 +20,52 @@
     private:
 
 // IMPLEMENT_CLASS 매크로 - cpp 파일에서 사용
-#define IMPLEMENT_CLASS(ClassName, SuperClassName)  \
-    UClass* ClassName::GetStaticClass()             \
-    {                                               \
-        static UClass* StaticClass = nullptr;       \
-        if (!StaticClass)                           \
-        {                                           \
-            StaticClass = new UClass(               \
-                FName(#ClassName),                  \
-                SuperClassName::GetStaticClass(),   \
-                &ClassName::CreateInstance          \
-            );                                      \
-            UClass::RegisterClass(StaticClass);     \
-        }                                           \
-        return StaticClass;                         \
-    }                                               \
-    UClass* ClassName::GetClass() const             \
-    {                                               \
-        return ClassName::GetStaticClass();         \
+// StaticClass는 함수 내 정적 변수로 초기화되므로 여러 스레드가 처음 호출해도 한 번만 생성/등록된다
+// 클래스가 DECLARE_PROPERTIES()로 StaticRegisterProperties를 직접 선언했다면 등록 전에 호출한다
+// (선언하지 않았으면 부모의 것을 가리키므로 건너뛴다 - 부모 프로퍼티는 상속으로 순회됨)
+#define IMPLEMENT_CLASS(ClassName, SuperClassName)                                                  \
+    UClass* ClassName::GetStaticClass()                                                             \
+    {                                                                                               \
+        static UClass* StaticClass = []()                                                           \
+        {                                                                                           \
+            UClass* NewClass = new UClass(                                                          \
+                FNAME_LITERAL(#ClassName),                                                          \
+                SuperClassName::GetStaticClass(),                                                   \
+                &ClassName::CreateInstance                                                          \
+            );                                                                                      \
+            if (&ClassName::StaticRegisterProperties != &SuperClassName::StaticRegisterProperties)  \
+            {                                                                                       \
+                ClassName::StaticRegisterProperties(NewClass);                                      \
+            }                                                                                       \
+            UClass::RegisterClass(NewClass);                                                        \
+            return NewClass;                                                                        \
+        }();                                                                                        \
+        return StaticClass;                                                                         \
+    }                                                                                               \
+    UClass* ClassName::GetClass() const                                                             \
+    {                                                                                               \
+        return ClassName::GetStaticClass();                                                         \
     }
 
 // 루트 클래스용 특별 매크로 (SuperClass가 없는 경우)
-#define IMPLEMENT_ROOT_CLASS(ClassName)         \
-    UClass* ClassName::GetStaticClass()         \
-    {                                           \
-        static UClass* StaticClass = nullptr;   \
-        if (!StaticClass)                       \
-        {                                       \
-            StaticClass = new UClass(           \
-                FName(#ClassName),              \
-                nullptr,                        \
-                &ClassName::CreateInstance      \
-            );                                  \
-            UClass::RegisterClass(StaticClass); \
-        }                                       \
-        return StaticClass;                     \
-    }                                           \
-    UClass* ClassName::GetClass() const         \
-    {                                           \
-        return ClassName::GetStaticClass();     \
+#define IMPLEMENT_ROOT_CLASS(ClassName)       \
+    UClass* ClassName::GetStaticClass()       \
+    {                                         \
+        static UClass* StaticClass = []()     \
+        {                                     \
+            UClass* NewClass = new UClass(    \
+                FNAME_LITERAL(#ClassName),    \
+                nullptr,                      \
+                &ClassName::CreateInstance    \
+            );                                \
+            UClass::RegisterClass(NewClass);  \
+            return NewClass;                  \
+        }();                                  \
+        return StaticClass;                   \
+    }                                         \
+    UClass* ClassName::GetClass() const       \
+    {                                         \
+        return ClassName::GetStaticClass();   \
     }
 
 // 타입 캐스팅 매크로
@@ -77,14 +84,14 @@
 #define IS_VALID(Object) \
     (Object && Object->IsValid())
 
-// 템플릿 캐스트 함수
+// 템플릿 캐스트 함수 - UClass::IsChildOf가 조상 배열 비교 한 번이므로 상속 깊이와 무관하게 O(1)
 template<typename T>
 T* Cast(UObject* Object)
 {
     if (!Object)
         return nullptr;
         
-    if (Object->IsA(T::GetStaticClass()))
+    if (Object->GetClass()->IsChildOf(T::GetStaticClass()))
     {
         return static_cast<T*>(Object);
     }
@@ -99,7 +106,7 @@ const T* Cast(const UObject* Object)
     if (!Object)
         return nullptr;
         
-    if (Object->IsA(T::GetStaticClass()))
+    if (Object->GetClass()->IsChildOf(T::GetStaticClass()))
     {
         return static_cast<const T*>(Object);
     }
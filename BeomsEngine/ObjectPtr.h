@@ -0,0 +1,89 @@
+#pragma once
+#include "WeakObjectPtr.h"
+#include <cassert>
+
+// 오브젝트를 소유하는 쪽의 참조 필드용 강한 핸들 (8바이트)
+// 저장 형식은 TWeakObjectPtr와 같아서 직접 delete된 오브젝트를 가리키면 dangling 포인터 대신 nullptr가 되지만,
+// - PendingKill인 오브젝트도 그대로 돌려준다 (소유자가 정리할 책임이 있음)
+// - 해제된 오브젝트를 역참조하면 assert로 즉시 잡는다
+// 오브젝트를 살려 두는 것은 GC 규칙 그대로다:
+// - 소유자의 AddReferencedObjects에서 Collector.AddReferencedObject(s)로 보고한다
+// - 핸들은 자신의 소유자를 모르므로, 값을 넣은 뒤 소유자가 ReferenceWriteBarrier를 호출한다
+template<typename T>
+class TObjectPtr
+{
+public:
+    TObjectPtr() = default;
+    TObjectPtr(std::nullptr_t) {}
+
+    TObjectPtr(T* Object)
+        : Handle(static_cast<const UObject*>(Object))
+    {
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    TObjectPtr(const TObjectPtr<U>& Other)
+        : Handle(Other.Handle)
+    {
+    }
+
+    TObjectPtr& operator=(T* Object)
+    {
+        Handle = static_cast<const UObject*>(Object);
+        return *this;
+    }
+
+    TObjectPtr& operator=(std::nullptr_t)
+    {
+        Handle.Reset();
+        return *this;
+    }
+
+    T* Get() const { return static_cast<T*>(Handle.Get(true)); }
+
+    // 가리킨 적이 있는데 이미 해제된 경우
+    bool IsStale() const { return Handle.IsStale(); }
+
+    T* operator->() const
+    {
+        T* Object = Get();
+        assert(Object && "TObjectPtr dereferenced after its object was freed");
+        return Object;
+    }
+
+    T& operator*() const { return *operator->(); }
+
+    operator T*() const { return Get(); }
+    explicit operator bool() const { return Get() != nullptr; }
+
+    bool operator==(const TObjectPtr& Other) const { return Handle == Other.Handle; }
+    bool operator!=(const TObjectPtr& Other) const { return Handle != Other.Handle; }
+
+    // std::find 등에서 원시 포인터와 바로 비교 (임시 핸들을 만들지 않는다)
+    bool operator==(const T* Object) const { return Get() == Object; }
+    bool operator!=(const T* Object) const { return Get() != Object; }
+    bool operator==(std::nullptr_t) const { return Get() == nullptr; }
+    bool operator!=(std::nullptr_t) const { return Get() != nullptr; }
+
+    size_t GetTypeHash() const { return Handle.GetTypeHash(); }
+
+private:
+    template<typename U>
+    friend class TObjectPtr;
+
+    FWeakObjectPtr Handle;
+};
+
+static_assert(sizeof(TObjectPtr<UObject>) == 8, "TObjectPtr must stay 8 bytes");
+
+namespace std
+{
+    template<typename T>
+    struct hash<TObjectPtr<T>>
+    {
+        size_t operator()(const TObjectPtr<T>& Ptr) const
+        {
+            return Ptr.GetTypeHash();
+        }
+    };
+}
@@ -1,11 +1,49 @@
 #include "pch.h"
 #include "PrimitiveComponent.h"
 
+namespace
+{
+    // 선분(Start + (End - Start) * t, 0 <= t <= 1)과 AABB의 교차 비율 - Start가 박스 안이면 빠져나가는 지점
+    bool IntersectSegmentBox(const FVector& Start, const FVector& End, const FVector& BoxMin, const FVector& BoxMax, float& OutTime)
+    {
+        FVector InvDir = FVector(
+            1.0f / (End.X - Start.X),
+            1.0f / (End.Y - Start.Y),
+            1.0f / (End.Z - Start.Z)
+        );
+
+        float t1 = (BoxMin.X - Start.X) * InvDir.X;
+        float t2 = (BoxMax.X - Start.X) * InvDir.X;
+        float t3 = (BoxMin.Y - Start.Y) * InvDir.Y;
+        float t4 = (BoxMax.Y - Start.Y) * InvDir.Y;
+        float t5 = (BoxMin.Z - Start.Z) * InvDir.Z;
+        float t6 = (BoxMax.Z - Start.Z) * InvDir.Z;
+
+        float tmin = fmax(fmax(fmin(t1, t2), fmin(t3, t4)), fmin(t5, t6));
+        float tmax = fmin(fmin(fmax(t1, t2), fmax(t3, t4)), fmax(t5, t6));
+
+        if (tmax < 0 || tmin > tmax || tmin > 1.0f)
+        {
+            return false;
+        }
+
+        OutTime = tmin > 0 ? tmin : tmax;
+        return true;
+    }
+}
+
 IMPLEMENT_CLASS(UPrimitiveComponent, USceneComponent)
 
+BEGIN_PROPERTIES(UPrimitiveComponent)
+    UPROPERTY_REGISTER(bVisible, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bHidden, EPropertyFlags::Edit)
+END_PROPERTIES()
+
 UPrimitiveComponent::UPrimitiveComponent()
     : bVisible(true)
     , bHidden(false)
+    , CachedWorldBoundsTransformVersion(0)
+    , bWorldBoundsValid(false)
 {
 }
 
@@ -31,6 +69,23 @@ void UPrimitiveComponent::Tick(float DeltaTime)
     Super::Tick(DeltaTime);
 }
 
+void UPrimitiveComponent::PostPropertyChanged(const FProperty& Property)
+{
+    Super::PostPropertyChanged(Property);
+
+    if (Property.Name == FNAME_LITERAL("bVisible") || Property.Name == FNAME_LITERAL("bHidden"))
+    {
+        MarkRenderStateDirty();
+    }
+}
+
+void UPrimitiveComponent::PostLoad()
+{
+    Super::PostLoad();
+
+    MarkRenderStateDirty();
+}
+
 void UPrimitiveComponent::SetVisibility(bool bNewVisibility)
 {
     if (bVisible != bNewVisibility)
@@ -63,7 +118,7 @@ FVector UPrimitiveComponent::GetBoundingBoxExtent() const
     return (Max - Min) * 0.5f;
 }
 
-FBoxSphereBounds UPrimitiveComponent::GetBounds() const
+FBoxSphereBounds UPrimitiveComponent::GetLocalBounds() const
 {
     FVector Min = GetBoundingBoxMin();
     FVector Max = GetBoundingBoxMax();
@@ -74,35 +129,48 @@ FBoxSphereBounds UPrimitiveComponent::GetBounds() const
     return FBoxSphereBounds(Origin, BoxExtent, SphereRadius);
 }
 
-bool UPrimitiveComponent::LineTraceComponent(const FVector& Start, const FVector& End, FVector& OutHitLocation) const
+const FBoxSphereBounds& UPrimitiveComponent::GetBounds() const
 {
-    // 기본 구현: 바운딩 박스와의 교차 검사
-    FVector BoxMin = GetBoundingBoxMin();
-    FVector BoxMax = GetBoundingBoxMax();
+    // 지연된 Transform 갱신을 먼저 끝내야 버전을 비교할 수 있다
+    const FTransform& LocalToWorld = GetComponentTransform();
+
+    if (!bWorldBoundsValid || CachedWorldBoundsTransformVersion != GetTransformVersion())
+    {
+        CachedWorldBounds = GetLocalBounds().TransformBy(LocalToWorld.ToMatrixWithScale());
+        CachedWorldBoundsTransformVersion = GetTransformVersion();
+        bWorldBoundsValid = true;
+    }
 
-    // 간단한 AABB 레이 교차 테스트
-    FVector InvDir = FVector(
-        1.0f / (End.X - Start.X),
-        1.0f / (End.Y - Start.Y),
-        1.0f / (End.Z - Start.Z)
-    );
+    return CachedWorldBounds;
+}
 
-    float t1 = (BoxMin.X - Start.X) * InvDir.X;
-    float t2 = (BoxMax.X - Start.X) * InvDir.X;
-    float t3 = (BoxMin.Y - Start.Y) * InvDir.Y;
-    float t4 = (BoxMax.Y - Start.Y) * InvDir.Y;
-    float t5 = (BoxMin.Z - Start.Z) * InvDir.Z;
-    float t6 = (BoxMax.Z - Start.Z) * InvDir.Z;
+void UPrimitiveComponent::InvalidateBounds()
+{
+    bWorldBoundsValid = false;
+}
+
+bool UPrimitiveComponent::LineTraceComponent(const FVector& Start, const FVector& End, FVector& OutHitLocation) const
+{
+    // 캐시된 월드 AABB로 먼저 걸러낸다 (회전된 박스를 감싸므로 실제 박스보다 크거나 같다)
+    const FBoxSphereBounds& WorldBounds = GetBounds();
+    float HitTime = 0.0f;
+    if (!IntersectSegmentBox(Start, End, WorldBounds.GetBoxMin(), WorldBounds.GetBoxMax(), HitTime))
+    {
+        return false;
+    }
 
-    float tmin = fmax(fmax(fmin(t1, t2), fmin(t3, t4)), fmin(t5, t6));
-    float tmax = fmin(fmin(fmax(t1, t2), fmax(t3, t4)), fmax(t5, t6));
+    // 선분을 로컬 공간으로 옮겨 로컬 박스(= 월드의 회전된 박스)와 정확히 검사
+    // 아핀 변환은 선분 위의 비율을 보존하므로 로컬에서 구한 비율을 월드 선분에 그대로 쓴다
+    const FTransform& LocalToWorld = GetComponentTransform();
+    const FVector LocalStart = LocalToWorld.InverseTransformPosition(Start);
+    const FVector LocalEnd = LocalToWorld.InverseTransformPosition(End);
 
-    if (tmax < 0 || tmin > tmax || tmin > 1.0f)
+    const FBoxSphereBounds LocalBounds = GetLocalBounds();
+    if (!IntersectSegmentBox(LocalStart, LocalEnd, LocalBounds.GetBoxMin(), LocalBounds.GetBoxMax(), HitTime))
     {
         return false;
     }
 
-    float t = tmin > 0 ? tmin : tmax;
-    OutHitLocation = Start + (End - Start) * t;
+    OutHitLocation = Start + (End - Start) * HitTime;
     return true;
 }
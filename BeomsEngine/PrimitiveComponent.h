@@ -7,6 +7,7 @@ class UPrimitiveComponent : public USceneComponent
 {
     UCLASS()
     GENERATED_BODY(UPrimitiveComponent, USceneComponent)
+    DECLARE_PROPERTIES()
 
 public:
     UPrimitiveComponent();
@@ -19,6 +20,8 @@ public:
     virtual void BeginPlay() override;
     virtual void EndPlay() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void PostPropertyChanged(const FProperty& Property) override;
+    virtual void PostLoad() override;
 
     // 렌더링 관련
     virtual bool ShouldRender() const { return bVisible && !bHidden; }
@@ -33,17 +36,20 @@ public:
     virtual class UMaterialInterface* GetMaterial(int32 MaterialIndex) const { return nullptr; }
     virtual int32 GetNumMaterials() const { return 0; }
 
-    // 바운딩 박스/스피어
+    // 바운딩 박스/스피어 (로컬 공간)
     virtual FVector GetBoundingBoxMin() const { return FVector::Zero; }
     virtual FVector GetBoundingBoxMax() const { return FVector::Zero; }
     virtual FVector GetBoundingBoxCenter() const;
     virtual FVector GetBoundingBoxExtent() const;
     virtual float GetBoundingSphereRadius() const { return 0.0f; }
 
-    // 통합 바운딩 정보
-    virtual FBoxSphereBounds GetBounds() const;
+    // 통합 바운딩 정보 (로컬 공간)
+    virtual FBoxSphereBounds GetLocalBounds() const;
 
-    // 레이캐스팅/트레이싱
+    // 월드 공간 바운딩 - Transform이나 로컬 바운딩이 바뀐 뒤 처음 읽을 때만 다시 계산한다
+    const FBoxSphereBounds& GetBounds() const;
+
+    // 레이캐스팅/트레이싱 (Start/End와 결과는 월드 공간)
     virtual bool LineTraceComponent(const FVector& Start, const FVector& End, FVector& OutHitLocation) const;
 
 protected:
@@ -54,4 +60,13 @@ protected:
     // 렌더링 상태 업데이트
     virtual void MarkRenderStateDirty() {}
     virtual void UpdateRenderState() {}
+
+    // 로컬 바운딩이 바뀌었을 때 호출 - 월드 바운딩 캐시 무효화
+    virtual void InvalidateBounds();
+
+private:
+    // 월드 바운딩 캐시 (계산할 때의 Transform 버전과 함께 저장)
+    mutable FBoxSphereBounds CachedWorldBounds;
+    mutable uint32 CachedWorldBoundsTransformVersion;
+    mutable bool bWorldBoundsValid;
 };
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "pch.h"
+#include "Property.h"
+#include "Object.h"
+#include <cstdio>
+#include <cstring>
+
+bool FProperty::Identical(const void* ContainerA, const void* ContainerB) const
+{
+    const void* ValueA = ContainerPtrToValuePtr(ContainerA);
+    const void* ValueB = ContainerPtrToValuePtr(ContainerB);
+
+    switch (Type)
+    {
+    case EPropertyType::Name:
+        return *static_cast<const FName*>(ValueA) == *static_cast<const FName*>(ValueB);
+
+    case EPropertyType::String:
+        return *static_cast<const FString*>(ValueA) == *static_cast<const FString*>(ValueB);
+
+    case EPropertyType::Object:
+        return *static_cast<UObject* const*>(ValueA) == *static_cast<UObject* const*>(ValueB);
+
+    default:
+        return std::memcmp(ValueA, ValueB, Size) == 0;
+    }
+}
+
+void FProperty::CopyValue(UObject* DestObject, const UObject* SrcObject) const
+{
+    void* Dest = ContainerPtrToValuePtr(DestObject);
+    const void* Src = ContainerPtrToValuePtr(SrcObject);
+
+    switch (Type)
+    {
+    case EPropertyType::Name:
+        *static_cast<FName*>(Dest) = *static_cast<const FName*>(Src);
+        break;
+
+    case EPropertyType::String:
+        *static_cast<FString*>(Dest) = *static_cast<const FString*>(Src);
+        break;
+
+    case EPropertyType::Object:
+    {
+        // 증분 마킹 중이거나 Dest가 오래된 오브젝트일 수 있으므로 GC에 새 참조를 알린다
+        UObject* Referenced = *static_cast<UObject* const*>(Src);
+        *static_cast<UObject**>(Dest) = Referenced;
+        DestObject->ReferenceWriteBarrier(Referenced);
+        break;
+    }
+
+    default:
+        std::memcpy(Dest, Src, Size);
+        break;
+    }
+
+    DestObject->PostPropertyChanged(*this);
+}
+
+FString FProperty::ExportText(const void* Container) const
+{
+    const void* Value = ContainerPtrToValuePtr(Container);
+    char Buffer[ 256 ];
+
+    switch (Type)
+    {
+    case EPropertyType::Bool:
+        return *static_cast<const bool*>(Value) ? "True" : "False";
+
+    case EPropertyType::Int32:
+        snprintf(Buffer, sizeof(Buffer), "%d", *static_cast<const int32*>(Value));
+        break;
+
+    case EPropertyType::UInt32:
+        snprintf(Buffer, sizeof(Buffer), "%u", *static_cast<const uint32*>(Value));
+        break;
+
+    case EPropertyType::Int64:
+        snprintf(Buffer, sizeof(Buffer), "%lld", *static_cast<const int64*>(Value));
+        break;
+
+    case EPropertyType::UInt64:
+        snprintf(Buffer, sizeof(Buffer), "%llu", *static_cast<const uint64*>(Value));
+        break;
+
+    case EPropertyType::Float:
+        snprintf(Buffer, sizeof(Buffer), "%f", *static_cast<const float*>(Value));
+        break;
+
+    case EPropertyType::Double:
+        snprintf(Buffer, sizeof(Buffer), "%f", *static_cast<const double*>(Value));
+        break;
+
+    case EPropertyType::Vector:
+    {
+        const FVector& Vector = *static_cast<const FVector*>(Value);
+        snprintf(Buffer, sizeof(Buffer), "(X=%f, Y=%f, Z=%f)", Vector.X, Vector.Y, Vector.Z);
+        break;
+    }
+
+    case EPropertyType::Vector2:
+    {
+        const FVector2& Vector = *static_cast<const FVector2*>(Value);
+        snprintf(Buffer, sizeof(Buffer), "(X=%f, Y=%f)", Vector.X, Vector.Y);
+        break;
+    }
+
+    case EPropertyType::Vector4:
+    {
+        const FVector4& Vector = *static_cast<const FVector4*>(Value);
+        snprintf(Buffer, sizeof(Buffer), "(X=%f, Y=%f, Z=%f, W=%f)", Vector.X, Vector.Y, Vector.Z, Vector.W);
+        break;
+    }
+
+    case EPropertyType::Matrix:
+    {
+        const FMatrix& Matrix = *static_cast<const FMatrix*>(Value);
+        FString Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            snprintf(Buffer, sizeof(Buffer), "[%f %f %f %f]", Matrix.M[ Row ][ 0 ], Matrix.M[ Row ][ 1 ], Matrix.M[ Row ][ 2 ], Matrix.M[ Row ][ 3 ]);
+            Result += Buffer;
+        }
+        return Result;
+    }
+
+    case EPropertyType::Quat:
+    {
+        const FQuat& Quat = *static_cast<const FQuat*>(Value);
+        snprintf(Buffer, sizeof(Buffer), "(X=%f, Y=%f, Z=%f, W=%f)", Quat.X, Quat.Y, Quat.Z, Quat.W);
+        break;
+    }
+
+    case EPropertyType::Transform:
+    {
+        const FTransform& Transform = *static_cast<const FTransform*>(Value);
+        const FQuat& Rotation = Transform.GetRotation();
+        const FVector& Translation = Transform.GetTranslation();
+        const FVector& Scale = Transform.GetScale3D();
+        snprintf(Buffer, sizeof(Buffer), "(Rotation=(X=%f, Y=%f, Z=%f, W=%f), Translation=(X=%f, Y=%f, Z=%f), Scale3D=(X=%f, Y=%f, Z=%f))",
+            Rotation.X, Rotation.Y, Rotation.Z, Rotation.W, Translation.X, Translation.Y, Translation.Z, Scale.X, Scale.Y, Scale.Z);
+        break;
+    }
+
+    case EPropertyType::Name:
+        return static_cast<const FName*>(Value)->ToString();
+
+    case EPropertyType::String:
+        return *static_cast<const FString*>(Value);
+
+    case EPropertyType::Object:
+    {
+        const UObject* Object = *static_cast<UObject* const*>(Value);
+        return Object ? Object->GetNameString() : "None";
+    }
+
+    default:
+        return FString();
+    }
+
+    return Buffer;
+}
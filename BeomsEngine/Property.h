@@ -0,0 +1,169 @@
+#pragma once
+#include "Types.h"
+#include "String.h"
+#include "Name.h"
+#include "Vector.h"
+#include "Vector2.h"
+#include "Vector4.h"
+#include "Matrix.h"
+#include "Quat.h"
+#include "Transform.h"
+#include <type_traits>
+#include <cstddef>
+
+// 전방 선언
+class UObject;
+
+// 리플렉션 프로퍼티 타입
+enum class EPropertyType : uint8
+{
+    Bool,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double,
+    Vector,
+    Vector2,
+    Vector4,
+    Matrix,
+    Quat,
+    Transform,
+    Name,       // 인덱스는 프로세스마다 다르므로 저장할 때는 문자열로 바꿔야 한다
+    String,
+    Object,     // UObject 파생 클래스 포인터
+};
+
+// 프로퍼티 플래그
+enum class EPropertyFlags : uint32
+{
+    None        = 0,
+    Edit        = 1 << 0,   // 에디터에서 표시/수정 가능
+    Transient   = 1 << 1,   // 저장/변경 감지 대상에서 제외
+};
+
+inline EPropertyFlags operator|(EPropertyFlags A, EPropertyFlags B)
+{
+    return static_cast<EPropertyFlags>(static_cast<uint32>(A) | static_cast<uint32>(B));
+}
+
+// C++ 타입 -> EPropertyType 매핑 (지원하지 않는 타입은 컴파일 에러)
+template<typename T, typename Enable = void>
+struct TPropertyTypeTraits;
+
+#define DEFINE_PROPERTY_TYPE_TRAITS(CppType, PropertyType) \
+    template<> struct TPropertyTypeTraits<CppType> { static constexpr EPropertyType Type = EPropertyType::PropertyType; };
+
+DEFINE_PROPERTY_TYPE_TRAITS(bool, Bool)
+DEFINE_PROPERTY_TYPE_TRAITS(int32, Int32)
+DEFINE_PROPERTY_TYPE_TRAITS(uint32, UInt32)
+DEFINE_PROPERTY_TYPE_TRAITS(int64, Int64)
+DEFINE_PROPERTY_TYPE_TRAITS(uint64, UInt64)
+DEFINE_PROPERTY_TYPE_TRAITS(float, Float)
+DEFINE_PROPERTY_TYPE_TRAITS(double, Double)
+DEFINE_PROPERTY_TYPE_TRAITS(FVector, Vector)
+DEFINE_PROPERTY_TYPE_TRAITS(FVector2, Vector2)
+DEFINE_PROPERTY_TYPE_TRAITS(FVector4, Vector4)
+DEFINE_PROPERTY_TYPE_TRAITS(FMatrix, Matrix)
+DEFINE_PROPERTY_TYPE_TRAITS(FQuat, Quat)
+DEFINE_PROPERTY_TYPE_TRAITS(FTransform, Transform)
+DEFINE_PROPERTY_TYPE_TRAITS(FName, Name)
+DEFINE_PROPERTY_TYPE_TRAITS(FString, String)
+
+#undef DEFINE_PROPERTY_TYPE_TRAITS
+
+template<typename T>
+struct TPropertyTypeTraits<T*, std::enable_if_t<std::is_base_of_v<UObject, T>>>
+{
+    static constexpr EPropertyType Type = EPropertyType::Object;
+};
+
+// 클래스 멤버 하나의 메타데이터
+struct FProperty
+{
+    FName Name;
+    EPropertyType Type;
+    uint32 Offset;      // 오브젝트 시작 주소로부터의 바이트 오프셋
+    uint32 Size;
+    EPropertyFlags Flags;
+
+    FProperty(const FName& InName, EPropertyType InType, uint32 InOffset, uint32 InSize, EPropertyFlags InFlags)
+        : Name(InName)
+        , Type(InType)
+        , Offset(InOffset)
+        , Size(InSize)
+        , Flags(InFlags)
+    {
+    }
+
+    bool HasAnyFlags(EPropertyFlags InFlags) const { return (static_cast<uint32>(Flags) & static_cast<uint32>(InFlags)) != 0; }
+
+    // 바이트 그대로 복사/비교/저장할 수 있는 타입인지 (FName, FString, 오브젝트 포인터 제외)
+    bool IsPOD() const { return Type != EPropertyType::Name && Type != EPropertyType::String && Type != EPropertyType::Object; }
+
+    void* ContainerPtrToValuePtr(void* Container) const { return static_cast<uint8*>(Container) + Offset; }
+    const void* ContainerPtrToValuePtr(const void* Container) const { return static_cast<const uint8*>(Container) + Offset; }
+
+    template<typename T>
+    T* ContainerPtrToValuePtr(void* Container) const { return static_cast<T*>(ContainerPtrToValuePtr(Container)); }
+
+    template<typename T>
+    const T* ContainerPtrToValuePtr(const void* Container) const { return static_cast<const T*>(ContainerPtrToValuePtr(Container)); }
+
+    // 두 오브젝트(같은 클래스)의 이 프로퍼티 값이 같은지
+    bool Identical(const void* ContainerA, const void* ContainerB) const;
+
+    // Src 오브젝트의 값을 Dest 오브젝트로 복사
+    // 오브젝트 참조는 Dest의 쓰기 배리어를 거치고, 복사 후 Dest의 PostPropertyChanged를 호출한다
+    void CopyValue(UObject* DestObject, const UObject* SrcObject) const;
+
+    // 디버그/에디터 표시용 문자열
+    FString ExportText(const void* Container) const;
+};
+
+// POD 프로퍼티가 메모리에서 연속으로 붙어 있는 구간 - 한 번의 memcpy로 저장/복원한다
+struct FPropertyRange
+{
+    uint32 Offset;
+    uint32 Size;
+};
+
+// OwnerType 안에서 멤버의 바이트 오프셋
+// UObject 파생 클래스는 가상 함수가 있어 offsetof가 조건부 지원(-Winvalid-offsetof)이므로 멤버 포인터로 구한다.
+// 부모 클래스에 선언된 멤버도 OwnerType 기준 오프셋이 나온다.
+template<typename OwnerType, typename MemberType, typename MemberOwnerType>
+inline uint32 GetPropertyOffset(MemberType MemberOwnerType::* Member)
+{
+    static_assert(std::is_base_of_v<MemberOwnerType, OwnerType>, "Member must belong to OwnerType or its base class");
+    return static_cast<uint32>(reinterpret_cast<size_t>(&(static_cast<OwnerType*>(nullptr)->*Member)));
+}
+
+// 프로퍼티 등록 매크로
+// 헤더의 클래스 선언 안에서 DECLARE_PROPERTIES(), cpp에서 다음처럼 정의한다.
+//
+//     BEGIN_PROPERTIES(USceneComponent)
+//         UPROPERTY_REGISTER(RelativeLocation, EPropertyFlags::Edit)
+//     END_PROPERTIES()
+//
+// IMPLEMENT_CLASS가 클래스를 만들 때 호출하며, 부모 클래스의 프로퍼티는 UClass::GetAllProperties에서 함께 순회된다.
+#define DECLARE_PROPERTIES()                                    \
+    public:                                                     \
+        static void StaticRegisterProperties(UClass* Class);    \
+    private:
+
+#define BEGIN_PROPERTIES(ClassName)                             \
+    void ClassName::StaticRegisterProperties(UClass* Class)     \
+    {                                                           \
+        using PropertyOwnerClass = ClassName;
+
+#define UPROPERTY_REGISTER(Member, PropertyFlags)                                                       \
+        Class->AddProperty(FProperty(                                                                   \
+            FNAME_LITERAL(#Member),                                                                     \
+            TPropertyTypeTraits<std::remove_cv_t<decltype(PropertyOwnerClass::Member)>>::Type,          \
+            GetPropertyOffset<PropertyOwnerClass>(&PropertyOwnerClass::Member),                         \
+            static_cast<uint32>(sizeof(PropertyOwnerClass::Member)),                                    \
+            PropertyFlags));
+
+#define END_PROPERTIES()                                        \
+    }
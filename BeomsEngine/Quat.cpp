@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "Quat.h"
+#include "Math.h"
+
+const FQuat FQuat::Identity(0.0f, 0.0f, 0.0f, 1.0f);
+
+FQuat::FQuat(const FMatrix& RotationMatrix)
+{
+    const FMatrix& M = RotationMatrix;
+    const float Trace = M.M[0][0] + M.M[1][1] + M.M[2][2];
+
+    // 가장 큰 성분을 기준으로 나머지를 구해야 수치적으로 안정적이다
+    if (Trace > 0.0f)
+    {
+        const float S = 0.5f / std::sqrt(Trace + 1.0f);
+        W = 0.25f / S;
+        X = (M.M[2][1] - M.M[1][2]) * S;
+        Y = (M.M[0][2] - M.M[2][0]) * S;
+        Z = (M.M[1][0] - M.M[0][1]) * S;
+    }
+    else if (M.M[0][0] > M.M[1][1] && M.M[0][0] > M.M[2][2])
+    {
+        const float S = 2.0f * std::sqrt(1.0f + M.M[0][0] - M.M[1][1] - M.M[2][2]);
+        W = (M.M[2][1] - M.M[1][2]) / S;
+        X = 0.25f * S;
+        Y = (M.M[0][1] + M.M[1][0]) / S;
+        Z = (M.M[0][2] + M.M[2][0]) / S;
+    }
+    else if (M.M[1][1] > M.M[2][2])
+    {
+        const float S = 2.0f * std::sqrt(1.0f + M.M[1][1] - M.M[0][0] - M.M[2][2]);
+        W = (M.M[0][2] - M.M[2][0]) / S;
+        X = (M.M[0][1] + M.M[1][0]) / S;
+        Y = 0.25f * S;
+        Z = (M.M[1][2] + M.M[2][1]) / S;
+    }
+    else
+    {
+        const float S = 2.0f * std::sqrt(1.0f + M.M[2][2] - M.M[0][0] - M.M[1][1]);
+        W = (M.M[1][0] - M.M[0][1]) / S;
+        X = (M.M[0][2] + M.M[2][0]) / S;
+        Y = (M.M[1][2] + M.M[2][1]) / S;
+        Z = 0.25f * S;
+    }
+}
+
+FQuat FQuat::MakeFromEuler(const FVector& Euler)
+{
+    // Rz(Roll) * Rx(Pitch) * Ry(Yaw)를 전개한 결과
+    float SP, CP, SY, CY, SR, CR;
+    FMath::SinCos(&SP, &CP, FMath::DegreesToRadians(Euler.X) * 0.5f);
+    FMath::SinCos(&SY, &CY, FMath::DegreesToRadians(Euler.Y) * 0.5f);
+    FMath::SinCos(&SR, &CR, FMath::DegreesToRadians(Euler.Z) * 0.5f);
+
+    return FQuat(
+        CR * SP * CY - SR * CP * SY,
+        CR * CP * SY + SR * SP * CY,
+        CR * SP * SY + SR * CP * CY,
+        CR * CP * CY - SR * SP * SY
+    );
+}
+
+FVector FQuat::Euler() const
+{
+    // 회전 행렬에서 필요한 원소만 계산해 AActor::SetActorTransform과 같은 방식으로 분해한다
+    const float M21 = 2.0f * (Y * Z + W * X);
+    const float Pitch = FMath::Asin(FMath::Clamp(M21, -1.0f, 1.0f));
+
+    FVector Result;
+    Result.X = FMath::RadiansToDegrees(Pitch);
+
+    if (FMath::Abs(FMath::Cos(Pitch)) > FMath::KINDA_SMALL_NUMBER)
+    {
+        const float M01 = 2.0f * (X * Y - W * Z);
+        const float M11 = 1.0f - 2.0f * (X * X + Z * Z);
+        const float M20 = 2.0f * (X * Z - W * Y);
+        const float M22 = 1.0f - 2.0f * (X * X + Y * Y);
+
+        Result.Y = FMath::RadiansToDegrees(FMath::Atan2(-M20, M22));
+        Result.Z = FMath::RadiansToDegrees(FMath::Atan2(-M01, M11));
+    }
+    else
+    {
+        // Gimbal lock - Yaw를 0으로 고정
+        const float M00 = 1.0f - 2.0f * (Y * Y + Z * Z);
+        const float M10 = 2.0f * (X * Y + W * Z);
+
+        Result.Y = 0.0f;
+        Result.Z = FMath::RadiansToDegrees(FMath::Atan2(M10, M00));
+    }
+
+    return Result;
+}
+
+FMatrix FQuat::ToMatrix() const
+{
+    const float X2 = X + X, Y2 = Y + Y, Z2 = Z + Z;
+    const float XX = X * X2, XY = X * Y2, XZ = X * Z2;
+    const float YY = Y * Y2, YZ = Y * Z2, ZZ = Z * Z2;
+    const float WX = W * X2, WY = W * Y2, WZ = W * Z2;
+
+    return FMatrix(
+        1.0f - (YY + ZZ), XY - WZ,          XZ + WY,          0.0f,
+        XY + WZ,          1.0f - (XX + ZZ), YZ - WX,          0.0f,
+        XZ - WY,          YZ + WX,          1.0f - (XX + YY), 0.0f,
+        0.0f,             0.0f,             0.0f,             1.0f
+    );
+}
+
+FQuat FQuat::Slerp(const FQuat& A, const FQuat& B, float Alpha)
+{
+    // 같은 회전을 나타내는 -B 중 가까운 쪽으로 보간
+    float CosOmega = A.Dot(B);
+    const float Sign = CosOmega < 0.0f ? -1.0f : 1.0f;
+    CosOmega *= Sign;
+
+    float ScaleA = 1.0f - Alpha;
+    float ScaleB = Alpha;
+    if (CosOmega < 0.9999f)
+    {
+        const float Omega = std::acos(CosOmega);
+        const float InvSin = 1.0f / std::sin(Omega);
+        ScaleA = std::sin(ScaleA * Omega) * InvSin;
+        ScaleB = std::sin(ScaleB * Omega) * InvSin;
+    }
+    ScaleB *= Sign;
+
+    return FQuat(
+        A.X * ScaleA + B.X * ScaleB,
+        A.Y * ScaleA + B.Y * ScaleB,
+        A.Z * ScaleA + B.Z * ScaleB,
+        A.W * ScaleA + B.W * ScaleB
+    ).GetNormalized();
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include "Vector.h"
+#include "Matrix.h"
+#include "VectorRegister.h"
+#include <cmath>
+
+// 회전 쿼터니언 (X, Y, Z, W) - W가 스칼라 부분이며 회전에는 단위 쿼터니언을 사용한다
+// 곱은 행렬과 같은 순서를 따른다: (A * B)는 B를 먼저 회전한 뒤 A를 회전한다.
+// 오일러 각은 FVector(Pitch, Yaw, Roll) 도 단위이며 CreateRotationFromEuler와 같은 Z*X*Y 순서다.
+struct FQuat
+{
+public:
+    float X, Y, Z, W;
+
+    FQuat() : X(0.0f), Y(0.0f), Z(0.0f), W(1.0f) {}
+    FQuat(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+
+    // 축(정규화 필요)을 기준으로 RadianAngle만큼 회전
+    FQuat(const FVector& Axis, float RadianAngle)
+    {
+        const float HalfAngle = RadianAngle * 0.5f;
+        const float Sin = std::sin(HalfAngle);
+        X = Axis.X * Sin;
+        Y = Axis.Y * Sin;
+        Z = Axis.Z * Sin;
+        W = std::cos(HalfAngle);
+    }
+
+    // 회전 행렬(스케일 없음)로부터 생성
+    explicit FQuat(const FMatrix& RotationMatrix);
+
+    static const FQuat Identity;
+
+    static FQuat MakeFromEuler(const FVector& Euler);
+
+    // 오일러 각(도)으로 변환
+    FVector Euler() const;
+
+    FQuat operator*(const FQuat& Other) const
+    {
+        FQuat Result;
+        VectorStore(VectorQuaternionMultiply(ToRegister(), Other.ToRegister()), &Result.X);
+        return Result;
+    }
+
+    FQuat& operator*=(const FQuat& Other)
+    {
+        *this = *this * Other;
+        return *this;
+    }
+
+    bool operator==(const FQuat& Other) const
+    {
+        const float Epsilon = 1e-6f;
+        return (std::abs(X - Other.X) < Epsilon) &&
+            (std::abs(Y - Other.Y) < Epsilon) &&
+            (std::abs(Z - Other.Z) < Epsilon) &&
+            (std::abs(W - Other.W) < Epsilon);
+    }
+
+    bool operator!=(const FQuat& Other) const
+    {
+        return !(*this == Other);
+    }
+
+    float Dot(const FQuat& Other) const
+    {
+        return X * Other.X + Y * Other.Y + Z * Other.Z + W * Other.W;
+    }
+
+    float SizeSquared() const
+    {
+        return X * X + Y * Y + Z * Z + W * W;
+    }
+
+    float Size() const
+    {
+        return std::sqrt(SizeSquared());
+    }
+
+    FQuat GetNormalized() const
+    {
+        const float SquareSum = SizeSquared();
+        if (SquareSum > 1e-8f)
+        {
+            const float Scale = 1.0f / std::sqrt(SquareSum);
+            return FQuat(X * Scale, Y * Scale, Z * Scale, W * Scale);
+        }
+        return Identity;
+    }
+
+    void Normalize()
+    {
+        *this = GetNormalized();
+    }
+
+    bool IsNormalized() const
+    {
+        return std::abs(1.0f - SizeSquared()) < 1e-4f;
+    }
+
+    // 단위 쿼터니언의 역회전
+    FQuat Inverse() const
+    {
+        return FQuat(-X, -Y, -Z, W);
+    }
+
+    FVector RotateVector(const FVector& V) const
+    {
+        FVector Result;
+        VectorStoreFloat3(VectorQuaternionRotateVector(ToRegister(), VectorLoadFloat3(&V.X)), &Result.X);
+        return Result;
+    }
+
+    FVector UnrotateVector(const FVector& V) const
+    {
+        FVector Result;
+        VectorStoreFloat3(VectorQuaternionRotateVector(VectorQuaternionConjugate(ToRegister()), VectorLoadFloat3(&V.X)), &Result.X);
+        return Result;
+    }
+
+    // 회전 행렬 (열 벡터 규약, 이동 없음)
+    FMatrix ToMatrix() const;
+
+    // 회전된 기저 축
+    FVector GetAxisX() const { return RotateVector(FVector(1.0f, 0.0f, 0.0f)); }
+    FVector GetAxisY() const { return RotateVector(FVector(0.0f, 1.0f, 0.0f)); }
+    FVector GetAxisZ() const { return RotateVector(FVector(0.0f, 0.0f, 1.0f)); }
+
+    // 최단 경로 구면 선형 보간 (결과는 정규화됨)
+    static FQuat Slerp(const FQuat& A, const FQuat& B, float Alpha);
+
+    VectorRegister ToRegister() const { return VectorLoad(&X); }
+};
@@ -192,6 +192,16 @@ void SLevelViewport::SetWorld(UWorld* InWorld)
     }
 }
 
+ULevel* SLevelViewport::GetLevel() const
+{
+    return CurrentLevel.Get();
+}
+
+UWorld* SLevelViewport::GetWorld() const
+{
+    return CurrentWorld.Get();
+}
+
 void SLevelViewport::SetViewportType(ELevelViewportType InType)
 {
     if (ViewportType != InType)
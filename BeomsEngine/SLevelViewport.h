@@ -2,6 +2,7 @@
 #include "SEditorViewport.h"
 #include "SPanel.h"
 #include "Delegate.h"
+#include "WeakObjectPtr.h"
 
 class ULevel;
 class UWorld;
@@ -55,8 +56,9 @@ private:
     TSharedPtr<SEditorViewport> EditorViewport;
 
     ELevelViewportType ViewportType = ELevelViewportType::Perspective;
-    ULevel* CurrentLevel = nullptr;
-    UWorld* CurrentWorld = nullptr;
+    // 뷰포트는 레벨/월드를 소유하지 않으므로 약한 참조로 들고 있는다
+    TWeakObjectPtr<ULevel> CurrentLevel;
+    TWeakObjectPtr<UWorld> CurrentWorld;
 
     bool bShowToolbar = true;
     bool bShowGrid = true;
@@ -73,8 +75,8 @@ public:
     void SetWorld(UWorld* InWorld);
     void SetViewportType(ELevelViewportType InType);
 
-    ULevel* GetLevel() const { return CurrentLevel; }
-    UWorld* GetWorld() const { return CurrentWorld; }
+    ULevel* GetLevel() const;
+    UWorld* GetWorld() const;
     ELevelViewportType GetViewportType() const { return ViewportType; }
 
     TSharedPtr<SEditorViewport> GetEditorViewport() const { return EditorViewport; }
@@ -7,14 +7,16 @@ SPanel::SPanel()
     bCanHaveChildren = true;
 }
 
-void SPanel::ArrangeChildren(const FGeometry& AllottedGeometry, TArray<FSlot>& ArrangedChildren) const
+void SPanel::ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
-    ArrangedChildren = Children;
+    ArrangedChildren.assign(Children.begin(), Children.end());
 }
 
 void SPanel::OnArrangeChildren(const FGeometry& AllottedGeometry)
 {
-    TArray<FSlot> ArrangedChildren;
+    // 배치 결과는 이 스코프 안에서만 사용하므로 프레임 아레나에 할당
+    FMemMark Mark(FMemStack::Get());
+    FArrangedChildren ArrangedChildren;
     ArrangeChildren(AllottedGeometry, ArrangedChildren);
 
     for (const FSlot& ChildSlot : ArrangedChildren)
@@ -80,7 +82,7 @@ FVector2 SHorizontalBox::ComputeDesiredSize(float LayoutScaleMultiplier) const
     return TotalDesiredSize * LayoutScaleMultiplier;
 }
 
-void SHorizontalBox::ArrangeChildren(const FGeometry& AllottedGeometry, TArray<::FSlot>& ArrangedChildren) const
+void SHorizontalBox::ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
     ArrangedChildren.clear();
 
@@ -162,7 +164,7 @@ FVector2 SVerticalBox::ComputeDesiredSize(float LayoutScaleMultiplier) const
     return TotalDesiredSize * LayoutScaleMultiplier;
 }
 
-void SVerticalBox::ArrangeChildren(const FGeometry& AllottedGeometry, TArray<::FSlot>& ArrangedChildren) const
+void SVerticalBox::ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
     ArrangedChildren.clear();
 
@@ -12,7 +12,7 @@ protected:
     TArray<FSlot> Children;
 
 public:
-    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, TArray<FSlot>& ArrangedChildren) const override;
+    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
     virtual void OnArrangeChildren(const FGeometry& AllottedGeometry) override;
 
     int32 GetChildrenCount() const { return static_cast<int32>(Children.size()); }
@@ -56,7 +56,7 @@ public:
     virtual ~SHorizontalBox() = default;
 
     virtual FVector2 ComputeDesiredSize(float LayoutScaleMultiplier = 1.0f) const override;
-    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, TArray<::FSlot>& ArrangedChildren) const override;
+    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
 
     FSlot& AddSlot();
     bool RemoveSlot(TSharedPtr<SWidget> SlotWidget);
@@ -95,7 +95,7 @@ public:
     virtual ~SVerticalBox() = default;
 
     virtual FVector2 ComputeDesiredSize(float LayoutScaleMultiplier = 1.0f) const override;
-    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, TArray<::FSlot>& ArrangedChildren) const override;
+    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
 
     FSlot& AddSlot();
     bool RemoveSlot(TSharedPtr<SWidget> SlotWidget);
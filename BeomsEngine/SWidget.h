@@ -18,7 +18,7 @@ protected:
 public:
     // 레이아웃 시스템
     virtual FVector2 ComputeDesiredSize(float LayoutScaleMultiplier = 1.0f) const = 0;
-    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, TArray<FSlot>& ArrangedChildren) const {}
+    virtual void ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const {}
     virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, float InDeltaTime) const;
 
     FVector2 GetDesiredSize() const;
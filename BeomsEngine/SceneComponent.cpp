@@ -1,31 +1,61 @@
 #include "pch.h"
 #include "SceneComponent.h"
 #include "ObjectInitializer.h"
+#include "TransformHierarchy.h"
 #include <algorithm>
 
 // RTTI 매크로 구현
 IMPLEMENT_CLASS(USceneComponent, UActorComponent)
 
+BEGIN_PROPERTIES(USceneComponent)
+    UPROPERTY_REGISTER(RelativeTransform, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(WorldTransform, EPropertyFlags::Transient)
+    UPROPERTY_REGISTER(bVisible, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bAbsoluteLocation, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bAbsoluteRotation, EPropertyFlags::Edit)
+    UPROPERTY_REGISTER(bAbsoluteScale, EPropertyFlags::Edit)
+END_PROPERTIES()
+
+FTransformUpdateStats USceneComponent::TransformStats;
+FTransformUpdateStats USceneComponent::LastFrameTransformStats;
+
 // USceneComponent 구현
 USceneComponent::USceneComponent()
     : UActorComponent()
-    , WorldLocation(FVector::Zero)
-    , WorldRotation(FVector::Zero)
-    , WorldScale(FVector::One)
-    , RelativeLocation(FVector::Zero)
-    , RelativeRotation(FVector::Zero)
-    , RelativeScale(FVector::One)
+    , WorldTransform(FTransform::Identity)
+    , RelativeTransform(FTransform::Identity)
     , AttachParent(nullptr)
     , bVisible(true)
     , bAbsoluteLocation(false)
     , bAbsoluteRotation(false)
     , bAbsoluteScale(false)
+    , bWorldTransformDirty(false)
+    , TransformVersion(0)
+    , CachedSubtreeSize(1)
+    , TransformLevel(INDEX_NONE)
+    , TransformIndex(INDEX_NONE)
 {
     SetName(FName("SceneComponent"));
     bCanEverTick = true;
+    
+    FTransformHierarchy::Get().Register(this);
 }
 
 USceneComponent::~USceneComponent()
+{
+    // GC를 거치지 않고 직접 삭제되는 경우에도 같은 정리를 수행 (GC 경로에서는 이미 분리됨)
+    USceneComponent::BeginDestroy();
+}
+
+void USceneComponent::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Super::AddReferencedObjects(Collector);
+
+    Collector.AddReferencedObject(AttachParent);
+    Collector.AddReferencedObjects(AttachChildren);
+}
+
+void USceneComponent::BeginDestroy()
 {
     // 부모에서 분리
     if (AttachParent)
@@ -41,81 +71,121 @@ USceneComponent::~USceneComponent()
         {
             Child->DetachFromComponent();
         }
+        else
+        {
+            AttachChildren.pop_back();
+        }
     }
+
+    // 자식이 모두 분리된 뒤에 계층 버퍼에서 제거 (직접 삭제 경로에서 두 번 호출될 수 있다)
+    FTransformHierarchy::Get().Unregister(this);
+
+    Super::BeginDestroy();
 }
 
-void USceneComponent::SetWorldLocation(const FVector& NewLocation)
+void USceneComponent::PostPropertyChanged(const FProperty& Property)
 {
-    WorldLocation = NewLocation;
-    
-    if (AttachParent && !bAbsoluteLocation)
-    {
-        // 부모가 있으면 상대 위치 계산
-        RelativeLocation = WorldLocation - AttachParent->GetComponentLocation();
-    }
-    else
+    Super::PostPropertyChanged(Property);
+
+    if (Property.Name == FNAME_LITERAL("RelativeTransform") ||
+        Property.Name == FNAME_LITERAL("bAbsoluteLocation") ||
+        Property.Name == FNAME_LITERAL("bAbsoluteRotation") ||
+        Property.Name == FNAME_LITERAL("bAbsoluteScale"))
     {
-        RelativeLocation = WorldLocation;
+        MarkTransformDirty();
     }
-    
-    UpdateChildTransforms();
 }
 
-void USceneComponent::SetWorldRotation(const FVector& NewRotation)
+void USceneComponent::PostLoad()
 {
-    WorldRotation = NewRotation;
-    
-    if (AttachParent && !bAbsoluteRotation)
+    Super::PostLoad();
+
+    MarkTransformDirty();
+}
+
+void USceneComponent::SetWorldTransform(const FTransform& NewTransform)
+{
+    if (AttachParent)
     {
-        // 부모가 있으면 상대 회전 계산
-        RelativeRotation = WorldRotation - AttachParent->GetComponentRotation();
+        // 부모가 있으면 부모 기준 상대 Transform 계산 (Absolute 성분은 World 값을 그대로 사용)
+        FTransform NewRelative = NewTransform.GetRelativeTransform(AttachParent->GetComponentTransform());
+        if (bAbsoluteLocation)
+        {
+            NewRelative.SetTranslation(NewTransform.GetTranslation());
+        }
+        if (bAbsoluteRotation)
+        {
+            NewRelative.SetRotation(NewTransform.GetRotation());
+        }
+        if (bAbsoluteScale)
+        {
+            NewRelative.SetScale3D(NewTransform.GetScale3D());
+        }
+        // World -> Relative 변환을 반복해도 쿼터니언 크기 오차가 쌓이지 않도록 정규화
+        NewRelative.SetRotation(NewRelative.GetRotation().GetNormalized());
+        RelativeTransform = NewRelative;
     }
     else
     {
-        RelativeRotation = WorldRotation;
+        RelativeTransform = NewTransform;
     }
     
-    UpdateChildTransforms();
+    MarkTransformDirty();
+}
+
+void USceneComponent::SetWorldLocation(const FVector& NewLocation)
+{
+    FTransform NewTransform = GetComponentTransform();
+    NewTransform.SetTranslation(NewLocation);
+    SetWorldTransform(NewTransform);
+}
+
+void USceneComponent::SetWorldRotation(const FVector& NewRotation)
+{
+    SetWorldRotation(FQuat::MakeFromEuler(NewRotation));
+}
+
+void USceneComponent::SetWorldRotation(const FQuat& NewRotation)
+{
+    FTransform NewTransform = GetComponentTransform();
+    NewTransform.SetRotation(NewRotation);
+    SetWorldTransform(NewTransform);
 }
 
 void USceneComponent::SetWorldScale(const FVector& NewScale)
 {
-    WorldScale = NewScale;
-    
-    if (AttachParent && !bAbsoluteScale)
-    {
-        // 부모가 있으면 상대 스케일 계산
-        FVector ParentScale = AttachParent->GetComponentScale();
-        RelativeScale = FVector(
-            ParentScale.X != 0.0f ? WorldScale.X / ParentScale.X : 1.0f,
-            ParentScale.Y != 0.0f ? WorldScale.Y / ParentScale.Y : 1.0f,
-            ParentScale.Z != 0.0f ? WorldScale.Z / ParentScale.Z : 1.0f
-        );
-    }
-    else
-    {
-        RelativeScale = WorldScale;
-    }
-    
-    UpdateChildTransforms();
+    FTransform NewTransform = GetComponentTransform();
+    NewTransform.SetScale3D(NewScale);
+    SetWorldTransform(NewTransform);
+}
+
+void USceneComponent::SetRelativeTransform(const FTransform& NewTransform)
+{
+    RelativeTransform = NewTransform;
+    MarkTransformDirty();
 }
 
 void USceneComponent::SetRelativeLocation(const FVector& NewLocation)
 {
-    RelativeLocation = NewLocation;
-    UpdateWorldTransform();
+    RelativeTransform.SetTranslation(NewLocation);
+    MarkTransformDirty();
 }
 
 void USceneComponent::SetRelativeRotation(const FVector& NewRotation)
 {
-    RelativeRotation = NewRotation;
-    UpdateWorldTransform();
+    SetRelativeRotation(FQuat::MakeFromEuler(NewRotation));
+}
+
+void USceneComponent::SetRelativeRotation(const FQuat& NewRotation)
+{
+    RelativeTransform.SetRotation(NewRotation);
+    MarkTransformDirty();
 }
 
 void USceneComponent::SetRelativeScale(const FVector& NewScale)
 {
-    RelativeScale = NewScale;
-    UpdateWorldTransform();
+    RelativeTransform.SetScale3D(NewScale);
+    MarkTransformDirty();
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* Parent)
@@ -130,10 +200,12 @@ void USceneComponent::AttachToComponent(USceneComponent* Parent)
         
         // 새 부모에 연결
         AttachParent = Parent;
+        ReferenceWriteBarrier(Parent);
         Parent->AddChild(this);
         
         // Transform 업데이트
-        UpdateWorldTransform();
+        FTransformHierarchy::Get().SetParent(this, Parent);
+        MarkTransformDirty();
     }
 }
 
@@ -141,62 +213,117 @@ void USceneComponent::DetachFromComponent()
 {
     if (AttachParent)
     {
+        // World Transform을 유지하도록 Relative Transform 업데이트 (부모를 끊기 전에 계산)
+        RelativeTransform = GetComponentTransform();
+        
         AttachParent->RemoveChild(this);
         AttachParent = nullptr;
         
-        // World Transform을 유지하도록 Relative Transform 업데이트
-        RelativeLocation = WorldLocation;
-        RelativeRotation = WorldRotation;
-        RelativeScale = WorldScale;
+        // World Transform은 그대로이므로 서브트리를 다시 표시할 필요가 없다
+        // 다만 조상에게서 전파받던 dirty가 끊기므로 계층 버퍼 슬롯은 직접 dirty로 표시해 남은 자손도 일괄 계산되게 한다
+        FTransformHierarchy::Get().SetParent(this, nullptr);
+        FTransformHierarchy::Get().MarkDirty(this);
     }
 }
 
-void USceneComponent::UpdateWorldTransform()
+void USceneComponent::UpdateWorldTransform() const
 {
     if (AttachParent)
     {
-        // 부모가 있으면 부모 기준으로 World Transform 계산
-        if (!bAbsoluteLocation)
+        // 부모가 있으면 부모 기준으로 World Transform 계산 (부모가 dirty면 먼저 계산된다)
+        WorldTransform = AttachParent->GetComponentTransform() * RelativeTransform;
+        
+        // Absolute 성분은 부모를 무시하고 Relative 값을 그대로 사용
+        if (bAbsoluteLocation)
         {
-            WorldLocation = AttachParent->GetComponentLocation() + RelativeLocation;
+            WorldTransform.SetTranslation(RelativeTransform.GetTranslation());
         }
         
-        if (!bAbsoluteRotation)
+        if (bAbsoluteRotation)
         {
-            WorldRotation = AttachParent->GetComponentRotation() + RelativeRotation;
+            WorldTransform.SetRotation(RelativeTransform.GetRotation());
         }
         
-        if (!bAbsoluteScale)
+        if (bAbsoluteScale)
         {
-            FVector ParentScale = AttachParent->GetComponentScale();
-            WorldScale = FVector(
-                RelativeScale.X * ParentScale.X,
-                RelativeScale.Y * ParentScale.Y,
-                RelativeScale.Z * ParentScale.Z
-            );
+            WorldTransform.SetScale3D(RelativeTransform.GetScale3D());
         }
     }
     else
     {
         // 부모가 없으면 Relative = World
-        WorldLocation = RelativeLocation;
-        WorldRotation = RelativeRotation;
-        WorldScale = RelativeScale;
+        WorldTransform = RelativeTransform;
+    }
+    
+    bWorldTransformDirty = false;
+    ++TransformVersion;
+    ++TransformStats.NumUpdates;
+}
+
+void USceneComponent::UpdateDirtySubtree() const
+{
+    if (bWorldTransformDirty)
+    {
+        UpdateWorldTransform();
+    }
+    
+    // 지연 계산으로 먼저 깨끗해진 자식 아래에도 dirty가 남을 수 있으므로 서브트리 전체를 훑는다
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->UpdateDirtySubtree();
+        }
     }
+}
+
+void USceneComponent::UpdateComponentToWorld()
+{
+    UpdateDirtySubtree();
+}
+
+void USceneComponent::MarkTransformDirty()
+{
+    ++TransformStats.NumInvalidations;
     
-    UpdateChildTransforms();
+    if (!bWorldTransformDirty)
+    {
+        CachedSubtreeSize = MarkSubtreeDirty();
+    }
+    
+    // 즉시 전파 방식이었다면 매번 서브트리 전체를 다시 계산했을 것이다
+    TransformStats.NumEagerUpdates += CachedSubtreeSize;
+    
+    FTransformHierarchy::Get().MarkDirty(this);
 }
 
-void USceneComponent::UpdateChildTransforms()
+int32 USceneComponent::MarkSubtreeDirty()
 {
-    // 모든 자식의 Transform 업데이트
+    bWorldTransformDirty = true;
+    
+    // dirty인 컴포넌트의 서브트리는 이미 모두 dirty이므로 거기서 멈춘다
+    int32 SubtreeSize = 1;
     for (USceneComponent* Child : AttachChildren)
     {
         if (Child)
         {
-            Child->UpdateWorldTransform();
+            SubtreeSize += Child->bWorldTransformDirty ? Child->CachedSubtreeSize : (Child->CachedSubtreeSize = Child->MarkSubtreeDirty());
         }
     }
+    return SubtreeSize;
+}
+
+void USceneComponent::FlushTransformUpdates()
+{
+    TransformStats.NumUpdates += FTransformHierarchy::Get().Update();
+    
+    LastFrameTransformStats = TransformStats;
+    TransformStats = FTransformUpdateStats();
+}
+
+int32 USceneComponent::GetNumPendingTransformUpdates()
+{
+    return FTransformHierarchy::Get().GetNumPendingUpdates();
 }
 
 void USceneComponent::AddChild(USceneComponent* Child)
@@ -204,6 +331,7 @@ void USceneComponent::AddChild(USceneComponent* Child)
     if (Child && std::find(AttachChildren.begin(), AttachChildren.end(), Child) == AttachChildren.end())
     {
         AttachChildren.push_back(Child);
+        ReferenceWriteBarrier(Child);
     }
 }
 
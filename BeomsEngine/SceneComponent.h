@@ -1,35 +1,101 @@
 #pragma once
 #include "ActorComponent.h"
 #include "Vector.h"
+#include "Transform.h"
 #include "Array.h"
 
+// 한 프레임 동안의 World Transform 갱신 통계
+struct FTransformUpdateStats
+{
+    int32 NumInvalidations;     // Transform을 바꾼 setter/부착 호출 수
+    int32 NumEagerUpdates;      // 즉시 전파했다면 다시 계산했을 컴포넌트 수 (호출마다 서브트리 크기)
+    int32 NumUpdates;           // 실제로 World Transform을 다시 계산한 컴포넌트 수
+
+    FTransformUpdateStats()
+        : NumInvalidations(0)
+        , NumEagerUpdates(0)
+        , NumUpdates(0)
+    {
+    }
+
+    int32 GetNumSavedUpdates() const { return NumEagerUpdates > NumUpdates ? NumEagerUpdates - NumUpdates : 0; }
+};
+
 // Scene Component - 3D 공간에서의 위치를 가지는 컴포넌트
+// World Transform은 지연 계산한다.
+// - setter는 자신과 서브트리를 dirty로 표시하기만 한다 (이미 dirty인 서브트리는 다시 순회하지 않음).
+// - 읽을 때(GetComponentTransform 등) 필요한 조상까지만 계산하고,
+//   남은 dirty 컴포넌트는 UWorld::Tick이 렌더링 전에 FlushTransformUpdates로 한 번에 계산한다.
+// - 일괄 계산은 FTransformHierarchy의 깊이별 버퍼를 얕은 깊이부터 훑는다 (포인터를 따라 재귀하지 않음).
+// - 워커 스레드에서는 생성과, 다음 FlushTransformUpdates 전(계층 버퍼에 배치되기 전)의 부착/setter/소멸만 할 수 있다.
 class USceneComponent : public UActorComponent
 {
     UCLASS()
     GENERATED_BODY(USceneComponent, UActorComponent)
+    DECLARE_PROPERTIES()
 public:
     USceneComponent();
     virtual ~USceneComponent();
     
     virtual FString GetClassName() const override { return "USceneComponent"; }
     
-    // Transform 관련
-    FVector GetComponentLocation() const { return WorldLocation; }
-    FVector GetComponentRotation() const { return WorldRotation; }
-    FVector GetComponentScale() const { return WorldScale; }
+    // GC
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual void BeginDestroy() override;
+    
+    // 리플렉션으로 Relative Transform이나 Absolute 설정이 바뀌었으면 dirty로 표시
+    virtual void PostPropertyChanged(const FProperty& Property) override;
+    virtual void PostLoad() override;
+    
+    // Transform 관련 (회전의 FVector 버전은 오일러 각(도) - 내부 저장은 쿼터니언)
+    const FTransform& GetComponentTransform() const
+    {
+        if (bWorldTransformDirty)
+        {
+            UpdateWorldTransform();
+        }
+        return WorldTransform;
+    }
+    
+    FVector GetComponentLocation() const { return GetComponentTransform().GetTranslation(); }
+    FVector GetComponentRotation() const { return GetComponentTransform().GetRotation().Euler(); }
+    FQuat GetComponentQuat() const { return GetComponentTransform().GetRotation(); }
+    FVector GetComponentScale() const { return GetComponentTransform().GetScale3D(); }
+    
+    bool IsWorldTransformDirty() const { return bWorldTransformDirty; }
+    
+    // World Transform을 다시 계산할 때마다 증가 - 파생 캐시(월드 바운딩 등)의 유효성 검사용
+    // GetComponentTransform으로 지연 계산을 끝낸 뒤에 읽어야 최신 값이다.
+    uint32 GetTransformVersion() const { return TransformVersion; }
     
+    // 자신과 서브트리의 dirty World Transform을 지금 계산
+    void UpdateComponentToWorld();
+    
+    // 대기 중인 모든 Transform 갱신을 처리하고 이번 프레임 통계를 마감한다 (프레임당 한 번)
+    static void FlushTransformUpdates();
+    
+    // 마지막으로 마감된 프레임의 통계 / 진행 중인 프레임의 통계
+    static const FTransformUpdateStats& GetLastFrameTransformStats() { return LastFrameTransformStats; }
+    static const FTransformUpdateStats& GetTransformStats() { return TransformStats; }
+    static int32 GetNumPendingTransformUpdates();
+    
+    void SetWorldTransform(const FTransform& NewTransform);
     void SetWorldLocation(const FVector& NewLocation);
     void SetWorldRotation(const FVector& NewRotation);
+    void SetWorldRotation(const FQuat& NewRotation);
     void SetWorldScale(const FVector& NewScale);
     
     // 상대 Transform
-    FVector GetRelativeLocation() const { return RelativeLocation; }
-    FVector GetRelativeRotation() const { return RelativeRotation; }
-    FVector GetRelativeScale() const { return RelativeScale; }
+    const FTransform& GetRelativeTransform() const { return RelativeTransform; }
+    FVector GetRelativeLocation() const { return RelativeTransform.GetTranslation(); }
+    FVector GetRelativeRotation() const { return RelativeTransform.GetRotation().Euler(); }
+    FQuat GetRelativeQuat() const { return RelativeTransform.GetRotation(); }
+    FVector GetRelativeScale() const { return RelativeTransform.GetScale3D(); }
     
+    void SetRelativeTransform(const FTransform& NewTransform);
     void SetRelativeLocation(const FVector& NewLocation);
     void SetRelativeRotation(const FVector& NewRotation);
+    void SetRelativeRotation(const FQuat& NewRotation);
     void SetRelativeScale(const FVector& NewScale);
     
     // 컴포넌트 계층구조
@@ -44,15 +110,11 @@ public:
     void SetVisibility(bool bNewVisible) { bVisible = bNewVisible; }
     
 protected:
-    // World Transform
-    FVector WorldLocation;
-    FVector WorldRotation;
-    FVector WorldScale;
+    // World Transform (= 부모의 World Transform * Relative Transform) - bWorldTransformDirty면 오래된 값
+    mutable FTransform WorldTransform;
     
     // Relative Transform (부모 기준)
-    FVector RelativeLocation;
-    FVector RelativeRotation;
-    FVector RelativeScale;
+    FTransform RelativeTransform;
     
     // 컴포넌트 계층구조
     USceneComponent* AttachParent;
@@ -64,11 +126,30 @@ protected:
     bool bAbsoluteRotation;
     bool bAbsoluteScale;
     
-    // Transform 업데이트
-    virtual void UpdateWorldTransform();
-    virtual void UpdateChildTransforms();
+    // Relative Transform이나 부모가 바뀌었을 때 호출 - 자신과 서브트리를 dirty로 표시한다
+    void MarkTransformDirty();
     
 private:
+    friend class FTransformHierarchy;
+    
+    // Transform 지연 갱신 상태
+    mutable bool bWorldTransformDirty;
+    mutable uint32 TransformVersion;
+    int32 CachedSubtreeSize;                // 마지막 표시 순회 때 센 서브트리 크기 (통계용 근사치)
+    int32 TransformLevel;                   // FTransformHierarchy 깊이 (배치 전이면 INDEX_NONE)
+    int32 TransformIndex;                   // 깊이 버퍼의 슬롯 (배치 전이면 대기 목록 인덱스, 계층 버퍼가 갱신)
+    
+    // 부모가 최신이 되도록 한 뒤 자신만 다시 계산 (읽기 시점의 지연 계산)
+    void UpdateWorldTransform() const;
+    
+    // 자신(dirty일 때)과 dirty인 자식들을 위에서부터 계산
+    void UpdateDirtySubtree() const;
+    
+    int32 MarkSubtreeDirty();
+    
+    static FTransformUpdateStats TransformStats;
+    static FTransformUpdateStats LastFrameTransformStats;
+    
     void AddChild(USceneComponent* Child);
     void RemoveChild(USceneComponent* Child);
 };
\ No newline at end of file
@@ -1,4 +1,118 @@
 #pragma once
-#include <unordered_set>
+#include "HashTable.h"
+
 template<typename T>
-using TSet = std::unordered_set<T>;
\ No newline at end of file
+struct TSetKeyFuncs
+{
+    using KeyType = T;
+
+    static const T& GetKey(const T& Element) { return Element; }
+};
+
+// 해시 집합 - TMap과 같은 플랫 테이블을 쓰며 std::unordered_set과 같은 이름의 인터페이스를 제공한다
+// 원소는 키 자체이므로 반복자로 원소를 수정하면 안 된다.
+template<typename T, typename HasherType = TDefaultHash<T>, typename KeyEqualType = std::equal_to<T>>
+class TSet
+{
+    using FTable = TFlatHashTable<T, TSetKeyFuncs<T>, HasherType, KeyEqualType>;
+
+public:
+    using key_type = T;
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = typename FTable::const_iterator;
+    using const_iterator = typename FTable::const_iterator;
+
+    TSet() = default;
+
+    TSet(std::initializer_list<T> InitList)
+    {
+        Table.Reserve(static_cast<int32>(InitList.size()));
+        for (const T& Element : InitList)
+        {
+            Add(Element);
+        }
+    }
+
+    // ------------------------------------------------------------
+    // 엔진 스타일 인터페이스
+    // ------------------------------------------------------------
+
+    int32 Num() const { return Table.Num(); }
+    bool IsEmpty() const { return Table.IsEmpty(); }
+
+    // 이미 있으면 아무것도 하지 않는다. bIsAlreadyInSet이 주어지면 기존 원소였는지 알려준다
+    void Add(const T& Element, bool* bIsAlreadyInSet = nullptr)
+    {
+        const bool bInserted = Table.FindOrEmplace(Element, Element).second;
+        if (bIsAlreadyInSet)
+        {
+            *bIsAlreadyInSet = !bInserted;
+        }
+    }
+
+    const T* Find(const T& Element) const
+    {
+        const int32 Index = Table.FindIndex(Element);
+        return Index != INDEX_NONE ? &Table.GetElement(Index) : nullptr;
+    }
+
+    bool Contains(const T& Element) const { return Table.FindIndex(Element) != INDEX_NONE; }
+
+    int32 Remove(const T& Element) { return Table.Remove(Element); }
+
+    void Reserve(int32 NumElements) { Table.Reserve(NumElements); }
+    void Reset() { Table.Reset(); }
+    void Empty(int32 ExpectedNumElements = 0) { Table.Empty(ExpectedNumElements); }
+
+    // ------------------------------------------------------------
+    // std::unordered_set 호환 인터페이스
+    // ------------------------------------------------------------
+
+    size_type size() const { return static_cast<size_type>(Table.Num()); }
+    bool empty() const { return Table.IsEmpty(); }
+
+    void clear() { Table.Reset(); }
+    void reserve(size_type Count) { Table.Reserve(static_cast<int32>(Count)); }
+
+    const_iterator begin() const { return Table.begin(); }
+    const_iterator cbegin() const { return Table.begin(); }
+    const_iterator end() const { return Table.end(); }
+    const_iterator cend() const { return Table.end(); }
+
+    const_iterator find(const T& Element) const { return Table.MakeIterator(Table.FindIndex(Element)); }
+
+    size_type count(const T& Element) const { return Contains(Element) ? 1 : 0; }
+    bool contains(const T& Element) const { return Contains(Element); }
+
+    std::pair<const_iterator, bool> insert(const T& Element)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Element, Element);
+        return { Table.MakeIterator(Index), bInserted };
+    }
+
+    std::pair<const_iterator, bool> insert(T&& Element)
+    {
+        auto [Index, bInserted] = Table.FindOrEmplace(Element, std::move(Element));
+        return { Table.MakeIterator(Index), bInserted };
+    }
+
+    template<typename... ArgsType>
+    std::pair<const_iterator, bool> emplace(ArgsType&&... Args)
+    {
+        return insert(T(std::forward<ArgsType>(Args)...));
+    }
+
+    size_type erase(const T& Element) { return static_cast<size_type>(Table.Remove(Element)); }
+
+    const_iterator erase(const_iterator It)
+    {
+        const int32 Index = Table.GetIteratorIndex(It);
+        Table.RemoveAt(Index);
+        const_iterator Next = Table.MakeIterator(Index);
+        return ++Next;
+    }
+
+private:
+    FTable Table;
+};
@@ -92,6 +92,9 @@ struct TSlot : public FSlotBase
 class SWidget;
 using FSlot = TSlot<SWidget>;
 
+// 레이아웃 계산 중에만 쓰는 배치 결과 - 프레임 아레나(FMemStack)에 할당된다
+using FArrangedChildren = TArray<FSlot, TMemStackAllocator<FSlot>>;
+
 // 렌더링 인자 - 위젯 렌더링에 필요한 정보 전달
 struct FPaintArgs
 {
@@ -14,11 +14,13 @@ UStaticMesh::~UStaticMesh()
 
 void UStaticMesh::SetRenderData(const FStaticMeshRenderData& InRenderData)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
     RenderData = InRenderData;
 }
 
 void UStaticMesh::SetRenderData(const FString& InFilePath, const TArray<FVertex>& InVertices, const TArray<uint32>& InIndices)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
     RenderData = FStaticMeshRenderData(InFilePath, InVertices, InIndices);
 }
 
@@ -118,6 +120,8 @@ const FBoxSphereBounds& UStaticMesh::GetBounds() const
 
 void UStaticMesh::BuildFromObjData(const FObjInfo& ObjData)
 {
+    FMemoryTagScope MemoryTagScope(EMemoryTag::MeshData);
+
     // 1. OBJ 데이터를 FVertex 배열로 변환
     TArray<FVertex> Vertices;
     TArray<uint32> Indices;
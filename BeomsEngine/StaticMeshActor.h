@@ -44,7 +44,7 @@ public:
     void SetHidden(bool bNewHidden);
     bool IsHidden() const;
 
-    // 바운딩 정보 (StaticMeshComponent로 위임)
+    // 바운딩 정보 (StaticMeshComponent로 위임 - GetBounds는 월드 공간, 나머지는 로컬 공간)
     FVector GetBoundingBoxMin() const;
     FVector GetBoundingBoxMax() const;
     FVector GetBoundingBoxCenter() const;
@@ -5,6 +5,10 @@
 
 IMPLEMENT_CLASS(UStaticMeshComponent, UMeshComponent)
 
+BEGIN_PROPERTIES(UStaticMeshComponent)
+    UPROPERTY_REGISTER(StaticMesh, EPropertyFlags::Edit)
+END_PROPERTIES()
+
 UStaticMeshComponent::UStaticMeshComponent()
     : StaticMesh(nullptr)
 {
@@ -14,6 +18,24 @@ UStaticMeshComponent::~UStaticMeshComponent()
 {
 }
 
+void UStaticMeshComponent::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Super::AddReferencedObjects(Collector);
+
+    Collector.AddReferencedObject(StaticMesh);
+}
+
+void UStaticMeshComponent::PostPropertyChanged(const FProperty& Property)
+{
+    Super::PostPropertyChanged(Property);
+
+    // SetStaticMesh를 거치지 않았으므로 바운딩/렌더 상태를 여기서 갱신 (쓰기 배리어는 CopyValue가 처리)
+    if (Property.Name == FNAME_LITERAL("StaticMesh"))
+    {
+        OnStaticMeshChanged();
+    }
+}
+
 void UStaticMeshComponent::BeginPlay()
 {
     Super::BeginPlay();
@@ -35,6 +57,7 @@ void UStaticMeshComponent::SetStaticMesh(UStaticMesh* InStaticMesh)
     if (StaticMesh != InStaticMesh)
     {
         StaticMesh = InStaticMesh;
+        ReferenceWriteBarrier(StaticMesh);
         OnStaticMeshChanged();
     }
 }
@@ -118,7 +141,7 @@ float UStaticMeshComponent::GetBoundingSphereRadius() const
     return StaticMesh->GetRenderData().GetBoundingSphereRadius();
 }
 
-FBoxSphereBounds UStaticMeshComponent::GetBounds() const
+FBoxSphereBounds UStaticMeshComponent::GetLocalBounds() const
 {
     if (!HasValidMeshData())
     {
@@ -11,6 +11,7 @@ class UStaticMeshComponent : public UMeshComponent
 {
     UCLASS()
     GENERATED_BODY(UStaticMeshComponent, UMeshComponent)
+    DECLARE_PROPERTIES()
 
 public:
     UStaticMeshComponent();
@@ -18,6 +19,8 @@ public:
 
     // UObject 오버라이드
     virtual FString GetClassName() const override { return "UStaticMeshComponent"; }
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual void PostPropertyChanged(const FProperty& Property) override;
 
     // UMeshComponent 오버라이드
     virtual void BeginPlay() override;
@@ -37,13 +40,13 @@ public:
     virtual uint32 GetNumTriangles() const override;
     virtual bool HasValidMeshData() const override;
 
-    // UPrimitiveComponent 오버라이드 - 바운딩
+    // UPrimitiveComponent 오버라이드 - 바운딩 (로컬 공간)
     virtual FVector GetBoundingBoxMin() const override;
     virtual FVector GetBoundingBoxMax() const override;
     virtual float GetBoundingSphereRadius() const override;
 
-    // 바운딩 정보 통합 접근
-    virtual FBoxSphereBounds GetBounds() const override;
+    // 바운딩 정보 통합 접근 (로컬 공간 - 월드 공간은 GetBounds)
+    virtual FBoxSphereBounds GetLocalBounds() const override;
 
     // 정적 메시 섹션 관리
     int32 GetNumSections() const;
@@ -0,0 +1,168 @@
+#include "pch.h"
+#include "Transform.h"
+#include "Math.h"
+
+// 다른 번역 단위의 정적 상수(FVector::One 등)는 초기화 순서가 보장되지 않으므로 값을 직접 쓴다
+const FTransform FTransform::Identity(FQuat(0.0f, 0.0f, 0.0f, 1.0f), FVector(0.0f, 0.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f));
+
+namespace
+{
+    // 0에 가까운 성분은 0으로 둔다 (무한대가 퍼지지 않도록)
+    FVector GetSafeScaleReciprocal(const FVector& Scale)
+    {
+        return FVector(
+            FMath::Abs(Scale.X) > FMath::SMALL_NUMBER ? 1.0f / Scale.X : 0.0f,
+            FMath::Abs(Scale.Y) > FMath::SMALL_NUMBER ? 1.0f / Scale.Y : 0.0f,
+            FMath::Abs(Scale.Z) > FMath::SMALL_NUMBER ? 1.0f / Scale.Z : 0.0f
+        );
+    }
+}
+
+FTransform::FTransform(const FMatrix& Matrix)
+{
+    const FMatrix& M = Matrix;
+    Translation = FVector(M.M[0][3], M.M[1][3], M.M[2][3]);
+
+    // 열 j = 회전된 j축 * 스케일 j
+    FVector Axes[ 3 ];
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Axes[ Axis ] = FVector(M.M[0][Axis], M.M[1][Axis], M.M[2][Axis]);
+        Scale3D[ Axis ] = Axes[ Axis ].Magnitude();
+    }
+
+    // 행렬식이 음수면 거울 변환이므로 X 스케일의 부호로 옮긴다
+    if (Axes[ 0 ].Cross(Axes[ 1 ]).Dot(Axes[ 2 ]) < 0.0f)
+    {
+        Scale3D.X = -Scale3D.X;
+    }
+
+    FMatrix RotationMatrix = FMatrix::Identity;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const bool bValidAxis = FMath::Abs(Scale3D[ Axis ]) > FMath::KINDA_SMALL_NUMBER;
+        for (int32 Row = 0; Row < 3; ++Row)
+        {
+            RotationMatrix.M[Row][Axis] = bValidAxis ? Axes[ Axis ][ Row ] / Scale3D[ Axis ] : (Row == Axis ? 1.0f : 0.0f);
+        }
+    }
+
+    Rotation = FQuat(RotationMatrix).GetNormalized();
+}
+
+FTransform FTransform::operator*(const FTransform& Other) const
+{
+    const VectorRegister QuatA = Rotation.ToRegister();
+    const VectorRegister ScaleA = VectorLoadFloat3(&Scale3D.X);
+    const VectorRegister TranslationA = VectorLoadFloat3(&Translation.X);
+
+    // R = Ra * Rb, S = Sa * Sb, T = Ra(Sa * Tb) + Ta
+    const VectorRegister Quat = VectorQuaternionMultiply(QuatA, Other.Rotation.ToRegister());
+    const VectorRegister Scale = VectorMultiply(ScaleA, VectorLoadFloat3(&Other.Scale3D.X));
+    const VectorRegister ScaledTranslation = VectorMultiply(ScaleA, VectorLoadFloat3(&Other.Translation.X));
+    const VectorRegister NewTranslation = VectorAdd(VectorQuaternionRotateVector(QuatA, ScaledTranslation), TranslationA);
+
+    FTransform Result;
+    VectorStore(Quat, &Result.Rotation.X);
+    VectorStoreFloat3(NewTranslation, &Result.Translation.X);
+    VectorStoreFloat3(Scale, &Result.Scale3D.X);
+    return Result;
+}
+
+FTransform FTransform::Inverse() const
+{
+    // (T * R * S)^-1 = S^-1 * R^-1 * T^-1
+    const FVector InvScale = GetSafeScaleReciprocal(Scale3D);
+    const VectorRegister InvScaleVec = VectorLoadFloat3(&InvScale.X);
+    const VectorRegister InvQuat = VectorQuaternionConjugate(Rotation.ToRegister());
+    const VectorRegister Unrotated = VectorQuaternionRotateVector(InvQuat, VectorLoadFloat3(&Translation.X));
+    const VectorRegister NewTranslation = VectorSubtract(VectorZero(), VectorMultiply(InvScaleVec, Unrotated));
+
+    FTransform Result;
+    VectorStore(InvQuat, &Result.Rotation.X);
+    VectorStoreFloat3(NewTranslation, &Result.Translation.X);
+    Result.Scale3D = InvScale;
+    return Result;
+}
+
+FTransform FTransform::GetRelativeTransform(const FTransform& Parent) const
+{
+    // R = Rp^-1 * R, S = S / Sp, T = Rp^-1(T - Tp) / Sp
+    const FVector InvParentScale = GetSafeScaleReciprocal(Parent.Scale3D);
+    const VectorRegister InvParentScaleVec = VectorLoadFloat3(&InvParentScale.X);
+    const VectorRegister InvParentQuat = VectorQuaternionConjugate(Parent.Rotation.ToRegister());
+
+    const VectorRegister Quat = VectorQuaternionMultiply(InvParentQuat, Rotation.ToRegister());
+    const VectorRegister Scale = VectorMultiply(VectorLoadFloat3(&Scale3D.X), InvParentScaleVec);
+    const VectorRegister Offset = VectorSubtract(VectorLoadFloat3(&Translation.X), VectorLoadFloat3(&Parent.Translation.X));
+    const VectorRegister NewTranslation = VectorMultiply(VectorQuaternionRotateVector(InvParentQuat, Offset), InvParentScaleVec);
+
+    FTransform Result;
+    VectorStore(Quat, &Result.Rotation.X);
+    VectorStoreFloat3(NewTranslation, &Result.Translation.X);
+    VectorStoreFloat3(Scale, &Result.Scale3D.X);
+    return Result;
+}
+
+FVector FTransform::TransformPosition(const FVector& Position) const
+{
+    const VectorRegister Scaled = VectorMultiply(VectorLoadFloat3(&Scale3D.X), VectorLoadFloat3(&Position.X));
+    const VectorRegister Result = VectorAdd(VectorQuaternionRotateVector(Rotation.ToRegister(), Scaled), VectorLoadFloat3(&Translation.X));
+
+    FVector Out;
+    VectorStoreFloat3(Result, &Out.X);
+    return Out;
+}
+
+FVector FTransform::TransformVector(const FVector& Vector) const
+{
+    const VectorRegister Scaled = VectorMultiply(VectorLoadFloat3(&Scale3D.X), VectorLoadFloat3(&Vector.X));
+
+    FVector Out;
+    VectorStoreFloat3(VectorQuaternionRotateVector(Rotation.ToRegister(), Scaled), &Out.X);
+    return Out;
+}
+
+FVector FTransform::InverseTransformPosition(const FVector& Position) const
+{
+    const FVector InvScale = GetSafeScaleReciprocal(Scale3D);
+    const VectorRegister Offset = VectorSubtract(VectorLoadFloat3(&Position.X), VectorLoadFloat3(&Translation.X));
+    const VectorRegister Unrotated = VectorQuaternionRotateVector(VectorQuaternionConjugate(Rotation.ToRegister()), Offset);
+
+    FVector Out;
+    VectorStoreFloat3(VectorMultiply(Unrotated, VectorLoadFloat3(&InvScale.X)), &Out.X);
+    return Out;
+}
+
+FMatrix FTransform::ToMatrixWithScale() const
+{
+    FMatrix Result = Rotation.ToMatrix();
+    for (int32 Row = 0; Row < 3; ++Row)
+    {
+        Result.M[Row][0] *= Scale3D.X;
+        Result.M[Row][1] *= Scale3D.Y;
+        Result.M[Row][2] *= Scale3D.Z;
+        Result.M[Row][3] = Translation[ Row ];
+    }
+    return Result;
+}
+
+FMatrix FTransform::ToMatrixNoScale() const
+{
+    FMatrix Result = Rotation.ToMatrix();
+    for (int32 Row = 0; Row < 3; ++Row)
+    {
+        Result.M[Row][3] = Translation[ Row ];
+    }
+    return Result;
+}
+
+bool FTransform::Equals(const FTransform& Other, float Tolerance) const
+{
+    // q와 -q는 같은 회전이다
+    const float RotationDot = FMath::Abs(Rotation.Dot(Other.Rotation));
+
+    return FMath::Abs(1.0f - RotationDot) <= Tolerance &&
+        (Translation - Other.Translation).MagnitudeSquared() <= Tolerance * Tolerance &&
+        (Scale3D - Other.Scale3D).MagnitudeSquared() <= Tolerance * Tolerance;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Vector.h"
+#include "Quat.h"
+#include "Matrix.h"
+
+// 이동/회전/스케일 변환 - 행렬로는 T * R * S (스케일 -> 회전 -> 이동 순으로 적용)
+// 곱은 행렬과 같은 순서를 따른다: Parent * Relative = World
+// 비균등 스케일이 있는 부모 아래에서 자식이 회전하면 행렬 곱과 달리 전단(shear)은 표현하지 못한다.
+struct FTransform
+{
+public:
+    FQuat Rotation;
+    FVector Translation;
+    FVector Scale3D;
+
+    FTransform()
+        : Rotation(0.0f, 0.0f, 0.0f, 1.0f)
+        , Translation(0.0f, 0.0f, 0.0f)
+        , Scale3D(1.0f, 1.0f, 1.0f)
+    {}
+
+    FTransform(const FQuat& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector::One)
+        : Rotation(InRotation)
+        , Translation(InTranslation)
+        , Scale3D(InScale3D)
+    {}
+
+    // T * R * S 형태의 아핀 행렬을 분해한다
+    explicit FTransform(const FMatrix& Matrix);
+
+    static const FTransform Identity;
+
+    const FQuat& GetRotation() const { return Rotation; }
+    const FVector& GetTranslation() const { return Translation; }
+    const FVector& GetScale3D() const { return Scale3D; }
+
+    void SetRotation(const FQuat& NewRotation) { Rotation = NewRotation; }
+    void SetTranslation(const FVector& NewTranslation) { Translation = NewTranslation; }
+    void SetScale3D(const FVector& NewScale3D) { Scale3D = NewScale3D; }
+
+    // this * Other - Other를 먼저 적용한다
+    FTransform operator*(const FTransform& Other) const;
+
+    FTransform& operator*=(const FTransform& Other)
+    {
+        *this = *this * Other;
+        return *this;
+    }
+
+    FTransform Inverse() const;
+
+    // Parent * Result == this 가 되는 Result (부모 기준 상대 변환)
+    FTransform GetRelativeTransform(const FTransform& Parent) const;
+
+    FVector TransformPosition(const FVector& Position) const;
+    FVector TransformVector(const FVector& Vector) const;
+    FVector InverseTransformPosition(const FVector& Position) const;
+
+    FMatrix ToMatrixWithScale() const;
+    FMatrix ToMatrixNoScale() const;
+
+    bool Equals(const FTransform& Other, float Tolerance = 1e-4f) const;
+};
@@ -0,0 +1,148 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "ObjectInitializer.h"
+#include "SceneComponent.h"
+#include "TransformHierarchy.h"
+#include <climits>
+#include <thread>
+
+namespace
+{
+    // 루트 256개 아래로 3갈래씩 4단계 (깊이 5, 30976개) - 가장 깊은 두 단계는 병렬 문턱을 넘는다
+    void BuildForest(TArray<USceneComponent*>& OutRoots, TArray<USceneComponent*>& OutComponents, TArray<USceneComponent*>& OutLeaves)
+    {
+        TArray<USceneComponent*> Parents;
+        TArray<USceneComponent*> Children;
+        for (int32 RootIndex = 0; RootIndex < 256; ++RootIndex)
+        {
+            USceneComponent* Root = NewObject<USceneComponent>();
+            OutRoots.Add(Root);
+            OutComponents.Add(Root);
+
+            Parents.Reset();
+            Parents.Add(Root);
+            for (int32 Depth = 0; Depth < 4; ++Depth)
+            {
+                Children.Reset();
+                for (USceneComponent* Parent : Parents)
+                {
+                    for (int32 ChildIndex = 0; ChildIndex < 3; ++ChildIndex)
+                    {
+                        USceneComponent* Child = NewObject<USceneComponent>();
+                        Child->AttachToComponent(Parent);
+                        Child->SetRelativeLocation(FVector(1.0f, static_cast<float>(ChildIndex), 0.0f));
+                        Children.Add(Child);
+                        OutComponents.Add(Child);
+                    }
+                }
+                std::swap(Parents, Children);
+            }
+            for (USceneComponent* Leaf : Parents)
+            {
+                OutLeaves.Add(Leaf);
+            }
+        }
+        USceneComponent::FlushTransformUpdates();
+    }
+
+    void MoveRoots(const TArray<USceneComponent*>& Roots, float Offset)
+    {
+        for (USceneComponent* Root : Roots)
+        {
+            Root->SetRelativeLocation(FVector(Offset, 0.0f, 0.0f));
+        }
+    }
+
+    // 자식부터 지워야 부모의 분리 작업이 서브트리를 옮기지 않는다
+    void DestroyComponents(TArray<USceneComponent*>& Components)
+    {
+        for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+        {
+            delete Components[ Index ];
+        }
+        Components.Reset();
+        USceneComponent::FlushTransformUpdates();
+    }
+}
+
+// FTransformHierarchy - setter, 부착 후 갱신, 전체 갱신(재귀 대비), 병렬 경로(순차 대비)
+IMPLEMENT_BENCHMARK(TransformHierarchyUpdate)
+{
+    const int32 NumRuns = 31;
+
+    TArray<USceneComponent*> Roots;
+    TArray<USceneComponent*> Components;
+    TArray<USceneComponent*> Leaves;
+    BuildForest(Roots, Components, Leaves);
+
+    FTransformHierarchy& Hierarchy = FTransformHierarchy::Get();
+    FBenchmark::Report("%d components, %d levels, %u hardware threads\n", Hierarchy.Num(), Hierarchy.GetNumLevels(), std::thread::hardware_concurrency());
+
+    // setter - 이미 dirty인 잎이므로 순수한 setter 비용
+    const int32 NumSets = 100000;
+    float Offset = 0.0f;
+    const double SetTime = FBenchmark::MeasureBest(11, [&]()
+    {
+        for (int32 Index = 0; Index < NumSets; ++Index)
+        {
+            Leaves[ Index % Leaves.Num() ]->SetRelativeLocation(FVector(Offset += 1.0f, 0.0f, 0.0f));
+        }
+    });
+    USceneComponent::FlushTransformUpdates();
+    FBenchmark::Report("SetRelativeLocation                %8.2f ns\n", SetTime * 1000.0 / NumSets);
+
+    // 매 프레임 20개를 붙이고 갱신 - 새 컴포넌트만 배치되고 나머지 슬롯은 움직이지 않는다
+    TArray<USceneComponent*> Spawned;
+    double SpawnFrameTime = 0.0;
+    const int32 NumSpawnFrames = 200;
+    for (int32 Frame = 0; Frame < NumSpawnFrames; ++Frame)
+    {
+        for (int32 Index = 0; Index < 20; ++Index)
+        {
+            USceneComponent* Component = NewObject<USceneComponent>();
+            Component->AttachToComponent(Components[ (Frame * 20 + Index) * 7919 % Components.Num() ]);
+            Spawned.Add(Component);
+        }
+        const double Start = FBenchmark::NowMicroseconds();
+        USceneComponent::FlushTransformUpdates();
+        SpawnFrameTime += FBenchmark::NowMicroseconds() - Start;
+    }
+    DestroyComponents(Spawned);
+    FBenchmark::Report("attach 20 + flush                  %8.2f us/frame\n", SpawnFrameTime / NumSpawnFrames);
+
+    const double IdleTime = FBenchmark::MeasureBest(NumRuns, []() { USceneComponent::FlushTransformUpdates(); });
+    FBenchmark::Report("flush, nothing dirty               %8.2f us\n", IdleTime);
+
+    // 모든 루트를 옮긴 뒤 전체 갱신 - 루트마다 서브트리를 재귀로 계산하는 경우와 비교
+    // 재귀로 계산한 뒤에도 계층 버퍼의 dirty가 남으므로 그 정리는 측정에서 뺀다
+    double BestRecursive = 1e30;
+    double BestFlush = 1e30;
+    for (int32 Run = 0; Run < NumRuns; ++Run)
+    {
+        MoveRoots(Roots, Offset += 1.0f);
+        BestRecursive = std::min(BestRecursive, FBenchmark::MeasureBest(1, [&]()
+        {
+            for (USceneComponent* Root : Roots)
+            {
+                Root->UpdateComponentToWorld();
+            }
+        }));
+        USceneComponent::FlushTransformUpdates();
+
+        MoveRoots(Roots, Offset += 1.0f);
+        BestFlush = std::min(BestFlush, FBenchmark::MeasureBest(1, []() { USceneComponent::FlushTransformUpdates(); }));
+    }
+    FBenchmark::Report("move all roots: recursive %8.2f us   flush %8.2f us   (x%.2f)\n", BestRecursive, BestFlush, BestRecursive / BestFlush);
+
+    // 같은 갱신을 순차/병렬로 (루트를 옮기며 서브트리를 dirty로 표시하는 비용은 양쪽에 같이 들어간다)
+    // 코어가 하나뿐이면 병렬 쪽은 청크 분배 비용만큼 느리다 (그래서 기본 문턱은 코어 수를 보고 정한다)
+    const int32 DefaultThreshold = Hierarchy.GetParallelUpdateThreshold();
+    const int32 ParallelThreshold = FTransformHierarchy::DefaultParallelUpdateThreshold;
+    const TPair<double, double> ParallelTimes = FBenchmark::MeasureBestInterleaved(NumRuns,
+        [&]() { Hierarchy.SetParallelUpdateThreshold(INT_MAX); MoveRoots(Roots, Offset += 1.0f); USceneComponent::FlushTransformUpdates(); },
+        [&]() { Hierarchy.SetParallelUpdateThreshold(ParallelThreshold); MoveRoots(Roots, Offset += 1.0f); USceneComponent::FlushTransformUpdates(); });
+    Hierarchy.SetParallelUpdateThreshold(DefaultThreshold);
+    FBenchmark::Report("move all roots: sequential %8.2f us   parallel %8.2f us   (x%.2f)\n", ParallelTimes.first, ParallelTimes.second, ParallelTimes.first / ParallelTimes.second);
+
+    DestroyComponents(Components);
+}
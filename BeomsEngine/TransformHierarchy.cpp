@@ -0,0 +1,362 @@
+#include "pch.h"
+#include "TransformHierarchy.h"
+#include "SceneComponent.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <execution>
+
+FTransformHierarchy& FTransformHierarchy::Get()
+{
+    // 전역/정적 컴포넌트가 종료 시점에 Unregister할 수 있으므로 해제하지 않는다
+    static FTransformHierarchy* Instance = new FTransformHierarchy();
+    return *Instance;
+}
+
+void FTransformHierarchy::Register(USceneComponent* Owner)
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    // 대기 중에는 TransformIndex가 대기 목록의 인덱스
+    Owner->TransformLevel = INDEX_NONE;
+    Owner->TransformIndex = PendingRegistrations.Add(Owner);
+}
+
+void FTransformHierarchy::Unregister(USceneComponent* Owner)
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    if (Owner->TransformIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (Owner->TransformLevel == INDEX_NONE)
+    {
+        RemovePending(Owner);
+    }
+    else
+    {
+        // 빈 슬롯은 다음 Update에서 제거된다 (지금 옮기면 다른 슬롯의 인덱스가 바뀐다)
+        FLevel& Buffer = Levels[ Owner->TransformLevel ];
+        Buffer.Owners[ Owner->TransformIndex ] = nullptr;
+        Buffer.DirtyFlags[ Owner->TransformIndex ] = 0;
+        EmptySlots.Add({ Owner->TransformLevel, Owner->TransformIndex });
+    }
+
+    Owner->TransformLevel = INDEX_NONE;
+    Owner->TransformIndex = INDEX_NONE;
+}
+
+void FTransformHierarchy::SetParent(USceneComponent* Owner, USceneComponent* Parent)
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    if (Owner->TransformLevel == INDEX_NONE)
+    {
+        // 배치될 때 AttachParent를 따라 깊이가 정해진다
+        return;
+    }
+
+    if (Parent && Parent->TransformIndex == INDEX_NONE)
+    {
+        Parent = nullptr;
+    }
+
+    const int32 Level = Parent ? Place(Parent) + 1 : 0;
+    if (Level != Owner->TransformLevel)
+    {
+        MoveSubtree(Owner, Level, Parent);
+        return;
+    }
+
+    FLevel& Buffer = Levels[ Level ];
+    const int32 Index = Owner->TransformIndex;
+    Buffer.Parents[ Index ] = Parent ? Parent->TransformIndex : INDEX_NONE;
+    if (!Buffer.DirtyFlags[ Index ])
+    {
+        Buffer.DirtyFlags[ Index ] = 1;
+        ++NumPendingUpdates;
+    }
+}
+
+void FTransformHierarchy::MarkDirty(const USceneComponent* Owner)
+{
+    const int32 Level = Owner->TransformLevel;
+    if (Level == INDEX_NONE)
+    {
+        // 아직 배치되지 않은 컴포넌트는 배치될 때 dirty로 들어간다
+        return;
+    }
+
+    uint8& Dirty = Levels[ Level ].DirtyFlags[ Owner->TransformIndex ];
+    if (!Dirty)
+    {
+        Dirty = 1;
+        ++NumPendingUpdates;
+    }
+}
+
+int32 FTransformHierarchy::Num() const
+{
+    int32 NumSlots = 0;
+    for (const FLevel& Buffer : Levels)
+    {
+        NumSlots += Buffer.Owners.Num();
+    }
+    return NumSlots;
+}
+
+int32 FTransformHierarchy::GetNumPendingUpdates() const
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    return NumPendingUpdates + PendingRegistrations.Num();
+}
+
+int32 FTransformHierarchy::Place(USceneComponent* Owner)
+{
+    if (Owner->TransformLevel != INDEX_NONE)
+    {
+        return Owner->TransformLevel;
+    }
+
+    int32 Level = 0;
+    int32 ParentIndex = INDEX_NONE;
+    USceneComponent* Parent = Owner->AttachParent;
+    if (Parent && Parent->TransformIndex != INDEX_NONE)
+    {
+        Level = Place(Parent) + 1;
+        ParentIndex = Parent->TransformIndex;
+    }
+
+    RemovePending(Owner);
+    AddSlot(Owner, Level, ParentIndex);
+    return Level;
+}
+
+void FTransformHierarchy::RemovePending(USceneComponent* Owner)
+{
+    const int32 Index = Owner->TransformIndex;
+    PendingRegistrations.RemoveAtSwap(Index);
+    if (Index < PendingRegistrations.Num())
+    {
+        PendingRegistrations[ Index ]->TransformIndex = Index;
+    }
+}
+
+void FTransformHierarchy::AddSlot(USceneComponent* Owner, int32 Level, int32 ParentIndex)
+{
+    if (Levels.Num() <= Level)
+    {
+        Levels.SetNum(Level + 1);
+    }
+
+    FLevel& Buffer = Levels[ Level ];
+    Owner->TransformLevel = Level;
+    Owner->TransformIndex = Buffer.Owners.Add(Owner);
+    Buffer.Parents.Add(ParentIndex);
+    Buffer.DirtyFlags.Add(1);
+    Buffer.WorldRotations.Add(FQuat(0.0f, 0.0f, 0.0f, 1.0f));
+    Buffer.WorldTranslations.Add(FVector(0.0f, 0.0f, 0.0f));
+    Buffer.WorldScales.Add(FVector(1.0f, 1.0f, 1.0f));
+    ++NumPendingUpdates;
+}
+
+void FTransformHierarchy::RemoveSlot(int32 Level, int32 Index)
+{
+    FLevel& Buffer = Levels[ Level ];
+    Buffer.Owners.RemoveAtSwap(Index);
+    Buffer.Parents.RemoveAtSwap(Index);
+    Buffer.DirtyFlags.RemoveAtSwap(Index);
+    Buffer.WorldRotations.RemoveAtSwap(Index);
+    Buffer.WorldTranslations.RemoveAtSwap(Index);
+    Buffer.WorldScales.RemoveAtSwap(Index);
+
+    if (Index >= Buffer.Owners.Num())
+    {
+        return;
+    }
+
+    USceneComponent* Moved = Buffer.Owners[ Index ];
+    if (!Moved)
+    {
+        // 옮겨진 슬롯이 빈 슬롯이면 새 위치를 다시 기록한다
+        EmptySlots.Add({ Level, Index });
+        return;
+    }
+
+    Moved->TransformIndex = Index;
+    for (USceneComponent* Child : Moved->AttachChildren)
+    {
+        if (Child && Child->TransformLevel == Level + 1)
+        {
+            Levels[ Level + 1 ].Parents[ Child->TransformIndex ] = Index;
+        }
+    }
+}
+
+void FTransformHierarchy::MoveSubtree(USceneComponent* Owner, int32 Level, const USceneComponent* Parent)
+{
+    // RemoveSlot이 같은 깊이의 부모 슬롯을 옮길 수 있으므로 부모 인덱스는 제거한 뒤에 읽는다
+    RemoveSlot(Owner->TransformLevel, Owner->TransformIndex);
+    AddSlot(Owner, Level, Parent ? Parent->TransformIndex : INDEX_NONE);
+
+    for (USceneComponent* Child : Owner->AttachChildren)
+    {
+        if (Child && Child->TransformLevel != INDEX_NONE)
+        {
+            MoveSubtree(Child, Level + 1, Owner);
+        }
+    }
+}
+
+void FTransformHierarchy::RemoveEmptySlots()
+{
+    // 뒤에서부터 지우면 마지막 슬롯(채우는 쪽)이 빈 슬롯이 아니다
+    // 같은 슬롯이 두 번 기록되었거나 이미 채워진 기록은 검사로 걸러진다
+    std::sort(EmptySlots.begin(), EmptySlots.end(), [](const FSlotHandle& A, const FSlotHandle& B)
+    {
+        return A.Level != B.Level ? A.Level < B.Level : A.Index > B.Index;
+    });
+
+    for (int32 Entry = 0; Entry < EmptySlots.Num(); ++Entry)
+    {
+        const FSlotHandle Slot = EmptySlots[ Entry ];
+        if (Slot.Level < Levels.Num() && Slot.Index < Levels[ Slot.Level ].Owners.Num() && !Levels[ Slot.Level ].Owners[ Slot.Index ])
+        {
+            RemoveSlot(Slot.Level, Slot.Index);
+        }
+    }
+    EmptySlots.Reset();
+}
+
+int32 FTransformHierarchy::Update()
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    if (EmptySlots.Num() > 0)
+    {
+        RemoveEmptySlots();
+    }
+
+    while (PendingRegistrations.Num() > 0)
+    {
+        Place(PendingRegistrations.Last());
+    }
+
+    // 서브트리가 얕은 곳으로 옮겨지면 깊은 쪽 깊이가 비어 남는다
+    while (Levels.Num() > 0 && Levels.Last().Owners.Num() == 0)
+    {
+        Levels.Pop();
+    }
+
+    int32 NumUpdated = 0;
+    for (int32 Level = 0; Level < Levels.Num(); ++Level)
+    {
+        const int32 NumSlots = Levels[ Level ].Owners.Num();
+
+        if (NumSlots >= ParallelUpdateThreshold)
+        {
+            // 같은 깊이의 슬롯은 앞 깊이만 읽으므로 청크 단위로 나누어 병렬 계산
+            ChunkStarts.Reset();
+            for (int32 Start = 0; Start < NumSlots; Start += ParallelChunkSize)
+            {
+                ChunkStarts.Add(Start);
+            }
+
+            std::atomic<int32> NumUpdatedInLevel = 0;
+            std::for_each(std::execution::par, ChunkStarts.begin(), ChunkStarts.end(), [this, Level, NumSlots, &NumUpdatedInLevel](int32 Start)
+            {
+                NumUpdatedInLevel += UpdateRange(Level, Start, std::min(Start + ParallelChunkSize, NumSlots));
+            });
+            NumUpdated += NumUpdatedInLevel;
+        }
+        else
+        {
+            NumUpdated += UpdateRange(Level, 0, NumSlots);
+        }
+    }
+
+    // 자식에게 전파하려고 남겨 둔 dirty 표시를 한 번에 지운다
+    for (FLevel& Buffer : Levels)
+    {
+        std::memset(Buffer.DirtyFlags.GetData(), 0, Buffer.DirtyFlags.Num());
+    }
+    NumPendingUpdates = 0;
+
+    return NumUpdated;
+}
+
+int32 FTransformHierarchy::UpdateRange(int32 Level, int32 Begin, int32 End)
+{
+    FLevel& Buffer = Levels[ Level ];
+    const FLevel* ParentBuffer = Level > 0 ? &Levels[ Level - 1 ] : nullptr;
+
+    int32 NumUpdated = 0;
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        const int32 Parent = Buffer.Parents[ Index ];
+        if (ParentBuffer && ParentBuffer->DirtyFlags[ Parent ])
+        {
+            Buffer.DirtyFlags[ Index ] = 1;
+        }
+
+        if (!Buffer.DirtyFlags[ Index ])
+        {
+            continue;
+        }
+
+        // 읽기 시점에 이미 계산된 컴포넌트는 값만 버퍼로 가져온다 (자손 계산에 필요)
+        USceneComponent* Owner = Buffer.Owners[ Index ];
+        if (!Owner->bWorldTransformDirty)
+        {
+            const FTransform& World = Owner->WorldTransform;
+            Buffer.WorldRotations[ Index ] = World.GetRotation();
+            Buffer.WorldTranslations[ Index ] = World.GetTranslation();
+            Buffer.WorldScales[ Index ] = World.GetScale3D();
+            continue;
+        }
+
+        // FTransform::operator*와 같은 연산 순서여야 USceneComponent의 지연 계산 결과와 일치한다
+        // R = Rp * R, S = Sp * S, T = Rp(Sp * T) + Tp
+        const FTransform& Local = Owner->RelativeTransform;
+        const VectorRegister LocalQuat = Local.GetRotation().ToRegister();
+        const VectorRegister LocalTranslation = VectorLoadFloat3(&Local.GetTranslation().X);
+        const VectorRegister LocalScale = VectorLoadFloat3(&Local.GetScale3D().X);
+
+        VectorRegister Quat = LocalQuat;
+        VectorRegister Translation = LocalTranslation;
+        VectorRegister Scale = LocalScale;
+        if (ParentBuffer)
+        {
+            const VectorRegister ParentQuat = ParentBuffer->WorldRotations[ Parent ].ToRegister();
+            const VectorRegister ParentScale = VectorLoadFloat3(&ParentBuffer->WorldScales[ Parent ].X);
+
+            // Absolute 성분은 부모를 무시하고 Local 값을 그대로 사용
+            if (!Owner->bAbsoluteRotation)
+            {
+                Quat = VectorQuaternionMultiply(ParentQuat, LocalQuat);
+            }
+            if (!Owner->bAbsoluteScale)
+            {
+                Scale = VectorMultiply(ParentScale, LocalScale);
+            }
+            if (!Owner->bAbsoluteLocation)
+            {
+                const VectorRegister ScaledTranslation = VectorMultiply(ParentScale, LocalTranslation);
+                Translation = VectorAdd(VectorQuaternionRotateVector(ParentQuat, ScaledTranslation), VectorLoadFloat3(&ParentBuffer->WorldTranslations[ Parent ].X));
+            }
+        }
+
+        VectorStore(Quat, &Buffer.WorldRotations[ Index ].X);
+        VectorStoreFloat3(Translation, &Buffer.WorldTranslations[ Index ].X);
+        VectorStoreFloat3(Scale, &Buffer.WorldScales[ Index ].X);
+
+        // 컴포넌트의 캐시도 최신으로 만든다 (슬롯마다 다른 컴포넌트이므로 병렬로 써도 된다)
+        Owner->WorldTransform = GetWorldTransform(Level, Index);
+        Owner->bWorldTransformDirty = false;
+        ++Owner->TransformVersion;
+        ++NumUpdated;
+    }
+    return NumUpdated;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include "Types.h"
+#include "Containers.h"
+#include "Transform.h"
+#include <climits>
+#include <mutex>
+#include <thread>
+
+class USceneComponent;
+
+// 씬 전체의 Transform 계층 버퍼
+// 깊이마다 따로 연속 배열(SoA)을 두고, 컴포넌트는 자기 깊이 버퍼의 슬롯 하나를 가진다.
+// - 부모는 항상 바로 앞 깊이에 있으므로 깊이 순으로 훑으면 부모가 먼저 계산된다 (전체 정렬이 필요 없다).
+// - setter는 자기 슬롯의 dirty만 표시하고 (잠금/복사 없음), Update가 부모의 dirty를 자식에게 전파하며
+//   컴포넌트의 RelativeTransform을 직접 읽어 계산한다.
+// - 부착/분리는 옮겨지는 서브트리의 슬롯만 다른 깊이로 옮긴다 (swap-remove 후 추가).
+// - 같은 깊이의 슬롯은 서로 의존하지 않으므로 코어가 여럿이면 큰 깊이는 청크로 나누어 병렬로 계산한다.
+//
+// 스레드 규칙
+// - Register/Unregister는 워커 스레드에서도 호출할 수 있다 (잠금, 다른 슬롯을 옮기지 않음).
+//   새 컴포넌트는 대기 목록에 들어갔다가 다음 Update에서 부모 깊이 아래에 배치되며,
+//   배치 전의 부착/setter는 버퍼를 건드리지 않는다.
+// - 배치된 컴포넌트의 MarkDirty/SetParent(부착된 컴포넌트의 소멸 포함)와 Update는 게임 스레드 전용이다.
+class FTransformHierarchy
+{
+public:
+    static constexpr int32 DefaultParallelUpdateThreshold = 1024;
+    static constexpr int32 ParallelChunkSize = 256;
+
+    static FTransformHierarchy& Get();
+
+    // 대기 목록에 넣는다 - 슬롯은 다음 Update(또는 배치된 부모/자식과의 부착)에서 할당된다
+    void Register(USceneComponent* Owner);
+
+    // 슬롯을 빈 슬롯으로 남기고 다음 Update에서 제거한다 (다른 슬롯은 움직이지 않음)
+    void Unregister(USceneComponent* Owner);
+
+    // Owner의 AttachParent가 바뀐 뒤 호출 - 깊이가 바뀌면 Owner의 서브트리만 새 깊이로 옮긴다
+    void SetParent(USceneComponent* Owner, USceneComponent* Parent);
+
+    // Owner의 RelativeTransform이나 Absolute 설정이 바뀌었음을 표시 (게임 스레드, 잠금 없음)
+    void MarkDirty(const USceneComponent* Owner);
+
+    // 대기 중인 컴포넌트를 배치하고 dirty 슬롯과 그 자손의 World Transform을 계산해 컴포넌트에 기록한다
+    // 지연 계산으로 이미 깨끗해진 컴포넌트는 다시 계산하지 않고 값만 버퍼로 가져온다
+    // 반환값은 실제로 다시 계산한 슬롯 수
+    int32 Update();
+
+    // 큰 깊이를 병렬로 계산하기 시작하는 슬롯 수 (벤치마크에서 순차 경로와 비교할 때 바꾼다)
+    void SetParallelUpdateThreshold(int32 NumSlots) { ParallelUpdateThreshold = NumSlots; }
+    int32 GetParallelUpdateThreshold() const { return ParallelUpdateThreshold; }
+
+    // 아래 조회는 게임 스레드에서 Update 직후에 사용한다 (빈 슬롯이 정리된 상태)
+    int32 Num() const;
+    int32 GetNumLevels() const { return Levels.Num(); }
+    int32 GetLevelNum(int32 Level) const { return Levels[ Level ].Owners.Num(); }
+    USceneComponent* GetOwner(int32 Level, int32 Index) const { return Levels[ Level ].Owners[ Index ]; }
+
+    // 부모 슬롯 (Level - 1 깊이의 인덱스, 루트면 INDEX_NONE)
+    int32 GetParent(int32 Level, int32 Index) const { return Levels[ Level ].Parents[ Index ]; }
+
+    FTransform GetWorldTransform(int32 Level, int32 Index) const
+    {
+        const FLevel& Buffer = Levels[ Level ];
+        return FTransform(Buffer.WorldRotations[ Index ], Buffer.WorldTranslations[ Index ], Buffer.WorldScales[ Index ]);
+    }
+
+    // dirty 표시 수 + 배치 대기 중인 컴포넌트 수
+    int32 GetNumPendingUpdates() const;
+
+private:
+    // 한 깊이의 슬롯들
+    struct FLevel
+    {
+        TArray<USceneComponent*> Owners;    // 빈 슬롯은 nullptr
+        TArray<int32> Parents;              // 앞 깊이의 부모 슬롯 (루트 깊이는 INDEX_NONE)
+        TArray<uint8> DirtyFlags;
+
+        TArray<FQuat> WorldRotations;
+        TArray<FVector> WorldTranslations;
+        TArray<FVector> WorldScales;
+    };
+
+    struct FSlotHandle
+    {
+        int32 Level;
+        int32 Index;
+    };
+
+    // 아래 함수들은 잠금을 잡은 상태에서 호출한다
+
+    // 대기 중인 Owner를 (필요하면 부모부터) 배치하고 깊이를 반환
+    int32 Place(USceneComponent* Owner);
+    void RemovePending(USceneComponent* Owner);
+
+    void AddSlot(USceneComponent* Owner, int32 Level, int32 ParentIndex);
+
+    // 마지막 슬롯을 Index로 옮겨 채운다 - 옮겨진 컴포넌트와 그 자식들의 부모 인덱스를 고친다
+    void RemoveSlot(int32 Level, int32 Index);
+
+    // Owner를 Level로 옮기고 배치된 자손도 따라 옮긴다
+    void MoveSubtree(USceneComponent* Owner, int32 Level, const USceneComponent* Parent);
+
+    void RemoveEmptySlots();
+
+    // Level 깊이의 [Begin, End) 슬롯을 계산 - 앞 깊이는 이미 끝나 있어야 한다
+    int32 UpdateRange(int32 Level, int32 Begin, int32 End);
+
+    TArray<FLevel> Levels;
+    TArray<USceneComponent*> PendingRegistrations;
+    TArray<FSlotHandle> EmptySlots;
+    TArray<int32> ChunkStarts;
+
+    int32 NumPendingUpdates = 0;
+    // 코어가 하나면 청크 분배 비용만 들고 이득이 없으므로 병렬 경로를 끈다
+    int32 ParallelUpdateThreshold = std::thread::hardware_concurrency() > 1 ? DefaultParallelUpdateThreshold : INT_MAX;
+
+    mutable std::mutex Mutex;
+};
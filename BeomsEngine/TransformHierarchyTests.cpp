@@ -0,0 +1,108 @@
+#include "pch.h"
+#include "AutomationTest.h"
+#include "ObjectInitializer.h"
+#include "SceneComponent.h"
+#include "TransformHierarchy.h"
+
+namespace
+{
+    // 모든 슬롯의 부모가 바로 앞 깊이에서 AttachParent를 가리키는지
+    bool IsHierarchyConsistent(const FTransformHierarchy& Hierarchy)
+    {
+        for (int32 Level = 0; Level < Hierarchy.GetNumLevels(); ++Level)
+        {
+            for (int32 Index = 0; Index < Hierarchy.GetLevelNum(Level); ++Index)
+            {
+                const USceneComponent* Owner = Hierarchy.GetOwner(Level, Index);
+                const int32 Parent = Hierarchy.GetParent(Level, Index);
+                if (!Owner)
+                {
+                    return false;
+                }
+                if (Level == 0 ? (Parent != INDEX_NONE || Owner->GetAttachParent()) :
+                    (Parent < 0 || Parent >= Hierarchy.GetLevelNum(Level - 1) || Hierarchy.GetOwner(Level - 1, Parent) != Owner->GetAttachParent()))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // 일괄 계산 결과가 부모 World * Relative와 같은지 (지연 계산을 거치지 않도록 dirty부터 확인)
+    bool IsWorldTransformUpToDate(const USceneComponent* Component)
+    {
+        if (Component->IsWorldTransformDirty())
+        {
+            return false;
+        }
+
+        const USceneComponent* Parent = Component->GetAttachParent();
+        const FTransform Expected = Parent ? Parent->GetComponentTransform() * Component->GetRelativeTransform() : Component->GetRelativeTransform();
+        return Component->GetComponentTransform().Equals(Expected, 1e-4f);
+    }
+}
+
+// 서브트리를 다른 깊이로 옮기고 중간 컴포넌트를 지운 뒤에도 계층 버퍼와 World Transform이 맞는다
+IMPLEMENT_TEST(TransformHierarchy_ReparentAndDestroy)
+{
+    FTransformHierarchy& Hierarchy = FTransformHierarchy::Get();
+
+    // A - B - C - D 사슬과 별도의 루트 E
+    TArray<USceneComponent*> Chain;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        USceneComponent* Component = NewObject<USceneComponent>();
+        if (Index > 0)
+        {
+            Component->AttachToComponent(Chain.Last());
+        }
+        Component->SetRelativeLocation(FVector(1.0f, 0.0f, 0.0f));
+        Component->SetRelativeRotation(FVector(0.0f, 0.0f, 30.0f));
+        Chain.Add(Component);
+    }
+    USceneComponent* Other = NewObject<USceneComponent>();
+    Other->SetRelativeScale(FVector(2.0f, 2.0f, 2.0f));
+
+    USceneComponent::FlushTransformUpdates();
+    TEST_CHECK(IsHierarchyConsistent(Hierarchy));
+    TEST_CHECK(Chain[ 3 ]->IsWorldTransformDirty() == false);
+
+    // 배치된 C(와 D)를 E 아래로 - 깊이가 2 -> 1로 바뀐다
+    Chain[ 2 ]->AttachToComponent(Other);
+    Other->SetRelativeLocation(FVector(0.0f, 5.0f, 0.0f));
+    USceneComponent::FlushTransformUpdates();
+    TEST_CHECK(IsHierarchyConsistent(Hierarchy));
+    for (USceneComponent* Component : Chain)
+    {
+        TEST_CHECK(IsWorldTransformUpToDate(Component));
+    }
+
+    // 다시 B 아래로 (배치 전 새 부모 아래에 붙인 컴포넌트도 함께)
+    USceneComponent* Late = NewObject<USceneComponent>();
+    Late->AttachToComponent(Chain[ 3 ]);
+    Chain[ 2 ]->AttachToComponent(Chain[ 1 ]);
+    USceneComponent::FlushTransformUpdates();
+    TEST_CHECK(IsHierarchyConsistent(Hierarchy));
+    TEST_CHECK(IsWorldTransformUpToDate(Late));
+
+    // 중간의 B를 지우면 C는 World Transform을 유지한 채 루트가 된다
+    const FTransform WorldBeforeDestroy = Chain[ 2 ]->GetComponentTransform();
+    delete Chain[ 1 ];
+    Chain[ 0 ]->SetRelativeLocation(FVector(-3.0f, 0.0f, 0.0f));
+    USceneComponent::FlushTransformUpdates();
+    TEST_CHECK(IsHierarchyConsistent(Hierarchy));
+    TEST_CHECK(Chain[ 2 ]->GetAttachParent() == nullptr);
+    TEST_CHECK(Chain[ 2 ]->GetComponentTransform().Equals(WorldBeforeDestroy, 1e-4f));
+    TEST_CHECK(IsWorldTransformUpToDate(Chain[ 3 ]));
+    TEST_CHECK(IsWorldTransformUpToDate(Late));
+    TEST_CHECK(USceneComponent::GetNumPendingTransformUpdates() == 0);
+
+    delete Late;
+    delete Chain[ 3 ];
+    delete Chain[ 2 ];
+    delete Chain[ 0 ];
+    delete Other;
+    USceneComponent::FlushTransformUpdates();
+    TEST_CHECK(IsHierarchyConsistent(Hierarchy));
+}
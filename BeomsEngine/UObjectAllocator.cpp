@@ -0,0 +1,236 @@
+#include "pch.h"
+#include "UObjectAllocator.h"
+
+FUObjectAllocator GUObjectAllocator;
+
+// 슬랩 헤더 - 슬랩(SlabSize 정렬) 맨 앞에 위치하므로 오브젝트 주소를 마스킹해서 찾을 수 있다
+struct alignas(64) FUObjectSlab
+{
+    FUObjectPool* Pool;
+    FUObjectSlab* Prev;
+    FUObjectSlab* Next;
+
+    // 해제된 슬롯들의 단일 연결 리스트 (슬롯 앞 8바이트에 다음 포인터 저장)
+    void* FreeList;
+
+    // 아직 한 번도 사용하지 않은 영역의 시작 (슬랩을 만들 때 전부 쪼개지 않기 위함)
+    uint8* BumpCursor;
+    uint8* BumpEnd;
+
+    int32 NumUsed;
+};
+
+namespace
+{
+    void LinkSlab(FUObjectSlab*& ListHead, FUObjectSlab* Slab)
+    {
+        Slab->Prev = nullptr;
+        Slab->Next = ListHead;
+        if (ListHead)
+        {
+            ListHead->Prev = Slab;
+        }
+        ListHead = Slab;
+    }
+
+    void UnlinkSlab(FUObjectSlab*& ListHead, FUObjectSlab* Slab)
+    {
+        if (Slab->Prev)
+        {
+            Slab->Prev->Next = Slab->Next;
+        }
+        else
+        {
+            ListHead = Slab->Next;
+        }
+
+        if (Slab->Next)
+        {
+            Slab->Next->Prev = Slab->Prev;
+        }
+
+        Slab->Prev = nullptr;
+        Slab->Next = nullptr;
+    }
+}
+
+FUObjectPool::FUObjectPool()
+    : ElementSize(0)
+    , ElementsPerSlab(0)
+    , AvailableSlabs(nullptr)
+    , FullSlabs(nullptr)
+    , NumSlabs(0)
+    , NumLiveObjects(0)
+{
+}
+
+void FUObjectPool::Initialize(size_t InElementSize)
+{
+    ElementSize = InElementSize;
+    ElementsPerSlab = static_cast<int32>((FUObjectAllocator::SlabSize - sizeof(FUObjectSlab)) / ElementSize);
+}
+
+FUObjectSlab* FUObjectPool::CreateSlab()
+{
+    void* Memory = FMemory::AllocPages(FUObjectAllocator::SlabSize, EMemoryTag::UObject);
+    if (!Memory)
+    {
+        return nullptr;
+    }
+
+    FUObjectSlab* Slab = static_cast<FUObjectSlab*>(Memory);
+    Slab->Pool = this;
+    Slab->Prev = nullptr;
+    Slab->Next = nullptr;
+    Slab->FreeList = nullptr;
+    Slab->BumpCursor = static_cast<uint8*>(Memory) + sizeof(FUObjectSlab);
+    Slab->BumpEnd = Slab->BumpCursor + ElementSize * ElementsPerSlab;
+    Slab->NumUsed = 0;
+
+    ++NumSlabs;
+    return Slab;
+}
+
+void* FUObjectPool::Allocate()
+{
+    std::lock_guard<std::mutex> Lock(PoolMutex);
+
+    FUObjectSlab* Slab = AvailableSlabs;
+    if (!Slab)
+    {
+        Slab = CreateSlab();
+        if (!Slab)
+        {
+            return nullptr;
+        }
+        LinkSlab(AvailableSlabs, Slab);
+    }
+
+    void* Result = nullptr;
+    if (Slab->FreeList)
+    {
+        Result = Slab->FreeList;
+        Slab->FreeList = *static_cast<void**>(Result);
+    }
+    else
+    {
+        Result = Slab->BumpCursor;
+        Slab->BumpCursor += ElementSize;
+    }
+
+    ++Slab->NumUsed;
+    ++NumLiveObjects;
+
+    // 가득 찬 슬랩은 할당 후보에서 제외
+    if (Slab->NumUsed == ElementsPerSlab)
+    {
+        UnlinkSlab(AvailableSlabs, Slab);
+        LinkSlab(FullSlabs, Slab);
+    }
+
+    return Result;
+}
+
+void FUObjectPool::Free(void* Ptr, FUObjectSlab* Slab)
+{
+    std::lock_guard<std::mutex> Lock(PoolMutex);
+
+    if (Slab->NumUsed == ElementsPerSlab)
+    {
+        UnlinkSlab(FullSlabs, Slab);
+        LinkSlab(AvailableSlabs, Slab);
+    }
+
+    *static_cast<void**>(Ptr) = Slab->FreeList;
+    Slab->FreeList = Ptr;
+
+    --Slab->NumUsed;
+    --NumLiveObjects;
+}
+
+int32 FUObjectPool::ReleaseEmptySlabs()
+{
+    std::lock_guard<std::mutex> Lock(PoolMutex);
+
+    int32 NumReleased = 0;
+    FUObjectSlab* Slab = AvailableSlabs;
+    while (Slab)
+    {
+        FUObjectSlab* Next = Slab->Next;
+        if (Slab->NumUsed == 0)
+        {
+            UnlinkSlab(AvailableSlabs, Slab);
+            FMemory::FreePages(Slab, FUObjectAllocator::SlabSize, EMemoryTag::UObject);
+            --NumSlabs;
+            ++NumReleased;
+        }
+        Slab = Next;
+    }
+    return NumReleased;
+}
+
+FUObjectAllocator::FUObjectAllocator()
+{
+    for (int32 i = 0; i < NumPools; ++i)
+    {
+        Pools[ i ].Initialize((i + 1) * SizeClassGranularity);
+    }
+}
+
+FUObjectAllocator::~FUObjectAllocator()
+{
+    // 종료 시점에 남은 오브젝트가 있을 수 있으므로 슬랩은 OS 정리에 맡긴다
+}
+
+void* FUObjectAllocator::Allocate(size_t Size)
+{
+    if (Size > MaxPooledSize)
+    {
+        return FMemory::Malloc(Size, FMemory::DEFAULT_ALIGNMENT, EMemoryTag::UObject);
+    }
+
+    return Pools[ GetPoolIndex(Size) ].Allocate();
+}
+
+void FUObjectAllocator::Free(void* Ptr, size_t Size)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+    if (Size > MaxPooledSize)
+    {
+        FMemory::Free(Ptr);
+        return;
+    }
+
+    FUObjectSlab* Slab = reinterpret_cast<FUObjectSlab*>(reinterpret_cast<uintptr_t>(Ptr) & ~(static_cast<uintptr_t>(SlabSize) - 1));
+    Slab->Pool->Free(Ptr, Slab);
+}
+
+int32 FUObjectAllocator::ReleaseEmptySlabs()
+{
+    int32 NumReleased = 0;
+    for (FUObjectPool& Pool : Pools)
+    {
+        NumReleased += Pool.ReleaseEmptySlabs();
+    }
+    return NumReleased;
+}
+
+FUObjectAllocator::FStats FUObjectAllocator::GetStats() const
+{
+    FStats Stats;
+    for (const FUObjectPool& Pool : Pools)
+    {
+        if (Pool.GetNumSlabs() > 0)
+        {
+            Stats.NumSlabs += Pool.GetNumSlabs();
+            Stats.NumLiveObjects += Pool.GetNumLiveObjects();
+            Stats.NumActivePools++;
+        }
+    }
+    Stats.ReservedBytes = static_cast<size_t>(Stats.NumSlabs) * SlabSize;
+    return Stats;
+}
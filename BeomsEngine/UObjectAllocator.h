@@ -0,0 +1,83 @@
+#pragma once
+#include "Types.h"
+#include "Memory.h"
+#include <mutex>
+
+struct FUObjectSlab;
+
+// 같은 크기 클래스의 UObject들을 슬랩 단위로 연속 배치하는 풀
+class FUObjectPool
+{
+public:
+    FUObjectPool();
+
+    void Initialize(size_t InElementSize);
+
+    void* Allocate();
+    void Free(void* Ptr, FUObjectSlab* Slab);
+
+    // 사용 중인 오브젝트가 없는 슬랩을 OS에 반환
+    int32 ReleaseEmptySlabs();
+
+    size_t GetElementSize() const { return ElementSize; }
+    int32 GetNumSlabs() const { return NumSlabs; }
+    int32 GetNumLiveObjects() const { return NumLiveObjects; }
+
+private:
+    size_t ElementSize;
+    int32 ElementsPerSlab;
+
+    // 빈 슬롯이 있는 슬랩 목록 / 가득 찬 슬랩 목록 (이중 연결 리스트)
+    FUObjectSlab* AvailableSlabs;
+    FUObjectSlab* FullSlabs;
+
+    int32 NumSlabs;
+    int32 NumLiveObjects;
+
+    std::mutex PoolMutex;
+
+    FUObjectSlab* CreateSlab();
+};
+
+// UObject 전용 할당자 - UObject::operator new/delete가 사용한다
+// 크기를 16바이트 단위 크기 클래스로 나눠 풀을 선택하고,
+// MaxPooledSize를 넘는 오브젝트는 FMemory::Malloc으로 보낸다.
+class FUObjectAllocator
+{
+public:
+    static constexpr size_t SlabSize = FMemory::PAGE_ALLOCATION_ALIGNMENT;
+    static constexpr size_t SizeClassGranularity = 16;
+    static constexpr size_t MaxPooledSize = 4096;
+    static constexpr int32 NumPools = static_cast<int32>(MaxPooledSize / SizeClassGranularity);
+
+    struct FStats
+    {
+        int32 NumSlabs;
+        int32 NumLiveObjects;
+        int32 NumActivePools;
+        size_t ReservedBytes;
+
+        FStats() : NumSlabs(0), NumLiveObjects(0), NumActivePools(0), ReservedBytes(0) {}
+    };
+
+    FUObjectAllocator();
+    ~FUObjectAllocator();
+
+    void* Allocate(size_t Size);
+    void Free(void* Ptr, size_t Size);
+
+    // GC 이후 호출 - 비어 있는 슬랩을 반환하고 반환한 슬랩 수를 돌려준다
+    int32 ReleaseEmptySlabs();
+
+    FStats GetStats() const;
+
+private:
+    FUObjectPool Pools[ NumPools ];
+
+    static int32 GetPoolIndex(size_t Size)
+    {
+        return static_cast<int32>((Size + SizeClassGranularity - 1) / SizeClassGranularity) - 1;
+    }
+};
+
+extern FUObjectAllocator GUObjectAllocator;
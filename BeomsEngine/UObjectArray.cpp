@@ -1,30 +1,162 @@
 #include "pch.h"
 #include "UObjectArray.h"
 #include "Object.h"
+#include "UObjectAllocator.h"
+#include "MemStack.h"
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <new>
 
 FUObjectArray GUObjectArray;
 
+namespace
+{
+    constexpr uint64 FreeListIndexMask = 0xFFFFFFFFull;
+
+    uint64 PackFreeListHead(uint64 Tag, int32 Index)
+    {
+        return (Tag << 32) | static_cast<uint32>(Index);
+    }
+
+    using FGCClock = std::chrono::high_resolution_clock;
+
+    double ToMilliseconds(FGCClock::duration Duration)
+    {
+        return std::chrono::duration<double, std::milli>(Duration).count();
+    }
+
+    // 시계 확인 비용을 줄이기 위해 이만큼 작업한 뒤에만 예산을 확인한다
+    constexpr int32 WorkUnitsPerBudgetCheck = 64;
+
+    // UClass::CreateDefaultObject가 생성자를 호출하기 직전에 설정하고 UObject 생성자(등록)에서 소비한다
+    // UObject 생성자는 파생 클래스 생성자 본문보다 먼저 실행되므로 중첩 생성과 섞이지 않는다.
+    thread_local const UClass* GClassOfNextObject = nullptr;
+
+    // GC 루트 - 루트 셋에 있거나 Outer가 없는 최상위 오브젝트
+    // 최상위 오브젝트는 GC 밖의 코드(팩토리가 돌려준 액터와 메시, 에디터/뷰포트가 쥔 포인터)가 소유하므로
+    // 따로 루트에 넣지 않아도 MarkPendingKill될 때까지 살아 있다. PendingKill은 FReferenceCollector가 걸러낸다.
+    bool IsGarbageCollectionRoot(const FUObjectItem& Item)
+    {
+        return Item.HasAnyFlags(EInternalObjectFlags::RootSet) || !Item.Object->GetOuter();
+    }
+
+    // 청크는 FMemory에 UObject 태그를 직접 지정해 할당한다 (전역 new는 기본적으로 FMemory를 거치지 않는다)
+    FUObjectItem* AllocateChunk()
+    {
+        void* Memory = FMemory::Malloc(sizeof(FUObjectItem) * FUObjectArray::NumElementsPerChunk, alignof(FUObjectItem), EMemoryTag::UObject);
+        if (!Memory)
+        {
+            throw std::bad_alloc();
+        }
+        FUObjectItem* Chunk = static_cast<FUObjectItem*>(Memory);
+        std::uninitialized_default_construct_n(Chunk, FUObjectArray::NumElementsPerChunk);
+        return Chunk;
+    }
+
+    void FreeChunk(FUObjectItem* Chunk)
+    {
+        if (Chunk)
+        {
+            std::destroy_n(Chunk, FUObjectArray::NumElementsPerChunk);
+            FMemory::Free(Chunk);
+        }
+    }
+}
+
 FUObjectArray::FUObjectArray()
-    : MaxObjectsEver(0)
+    : NumElements(0)
+    , MaxElements(MaxChunks * NumElementsPerChunk)
+    , FreeListHead(PackFreeListHead(0, -1))
     , OpenForDisregardForGarbageCollection(0)
+    , Phase(EGarbageCollectionPhase::Idle)
+    , RootScanCursor(0)
+    , SweepCursor(0)
+    , SweepEnd(0)
+    , PurgeCursor(0)
+    , TimeSinceLastMajorCollection(0.0f)
 {
-    ObjectList.reserve(1024);
-    ObjectAvailableList.reserve(256);
+    for (std::atomic<FUObjectItem*>& Chunk : Chunks)
+    {
+        Chunk.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 FUObjectArray::~FUObjectArray()
 {
-    for (int32 i = 0; i < ObjectList.size(); ++i)
+    // 이후에 소멸되는 전역 오브젝트가 해제를 시도해도 범위 검사에서 걸러지도록 먼저 비운다
+    NumElements.store(0);
+
+    for (std::atomic<FUObjectItem*>& Chunk : Chunks)
     {
-        FUObjectItem& Item = ObjectList[i];
-        if (Item.IsValid())
+        FreeChunk(Chunk.exchange(nullptr));
+    }
+}
+
+void FUObjectArray::AllocateObjectPool(int32 InMaxObjects)
+{
+    assert(NumElements.load() == 0 && "AllocateObjectPool must be called before any object is created");
+
+    MaxElements = std::min(InMaxObjects, MaxChunks * NumElementsPerChunk);
+
+    const int32 NumChunksNeeded = (MaxElements + NumElementsPerChunk - 1) / NumElementsPerChunk;
+    for (int32 i = 0; i < NumChunksNeeded; ++i)
+    {
+        GetOrCreateChunk(i);
+    }
+}
+
+FUObjectItem* FUObjectArray::GetOrCreateChunk(int32 ChunkIndex)
+{
+    FUObjectItem* Chunk = Chunks[ ChunkIndex ].load(std::memory_order_acquire);
+    if (!Chunk)
+    {
+        // 경계에 걸린 스레드가 여럿이면 먼저 게시한 청크를 쓰고 나머지는 버린다
+        FUObjectItem* NewChunk = AllocateChunk();
+        if (Chunks[ ChunkIndex ].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            Chunk = NewChunk;
+        }
+        else
         {
-            Item.Object = nullptr;
+            FreeChunk(NewChunk);
+        }
+    }
+    return Chunk;
+}
+
+int32 FUObjectArray::PopFreeIndex()
+{
+    uint64 Head = FreeListHead.load(std::memory_order_acquire);
+    for (;;)
+    {
+        const int32 Index = static_cast<int32>(Head & FreeListIndexMask);
+        if (Index < 0)
+        {
+            return -1;
+        }
+
+        const int32 Next = std::atomic_ref<int32>(GetItemUnchecked(Index)->NextFreeIndex).load(std::memory_order_relaxed);
+        if (FreeListHead.compare_exchange_weak(Head, PackFreeListHead((Head >> 32) + 1, Next), std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return Index;
+        }
+    }
+}
+
+void FUObjectArray::PushFreeIndex(int32 Index)
+{
+    std::atomic_ref<int32> Next(GetItemUnchecked(Index)->NextFreeIndex);
+
+    uint64 Head = FreeListHead.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Next.store(static_cast<int32>(Head & FreeListIndexMask), std::memory_order_relaxed);
+        if (FreeListHead.compare_exchange_weak(Head, PackFreeListHead((Head >> 32) + 1, Index), std::memory_order_release, std::memory_order_relaxed))
+        {
+            return;
         }
     }
-    
-    ObjectList.clear();
-    ObjectAvailableList.clear();
 }
 
 int32 FUObjectArray::AllocateUObjectIndex(UObject* Object, bool bMergeDuplicates)
@@ -36,34 +168,65 @@ int32 FUObjectArray::AllocateUObjectIndexInternal(UObject* Object, bool bMergeDu
 {
     if (!Object)
         return -1;
-        
-    int32 Index = -1;
     
-    // 중복 체크 옵션
-    if (bMergeDuplicates)
+    // 중복 체크 옵션 - 오브젝트가 기억하는 InternalIndex로 O(1) 확인
+    const int32 ExistingIndex = Object->GetInternalIndex();
+    const bool bAlreadyRegistered = ExistingIndex >= 0 && ExistingIndex < GetObjectArraySize()
+        && GetItemUnchecked(ExistingIndex)->Object == Object;
+    if (bMergeDuplicates && bAlreadyRegistered)
     {
-        for (int32 i = 0; i < ObjectList.size(); ++i)
-        {
-            if (ObjectList[i].Object == Object)
-            {
-                return i;   // 이미 존재하면 기존 인덱스 반환
-            }
-        }
+        return ExistingIndex;   // 이미 존재하면 기존 인덱스 반환
     }
+#ifdef _DEBUG
+    // 병합하지 않는 경로에서 이미 등록된 오브젝트가 다시 들어오는지 디버그 빌드에서만 확인
+    assert(!bAlreadyRegistered && "UObject registered twice in GUObjectArray");
+#endif
     
     // 재사용 가능 체크
-    if (ObjectAvailableList.size() > 0)
+    int32 Index = PopFreeIndex();
+    if (Index < 0)
     {
-        Index = ObjectAvailableList.back();
-        ObjectAvailableList.pop_back();
-        ObjectList[Index] = FUObjectItem(Object);   // 슬롯 재사용
+        // 안되면 새 슬롯 확보 - 한도를 넘겨 증가시키지 않도록 CAS로 확인하며 올린다
+        // (NumElements가 MaxElements를 넘으면 순회와 GetItemUnchecked가 만들어지지 않은 청크를 읽는다)
+        Index = NumElements.load(std::memory_order_acquire);
+        do
+        {
+            if (Index >= MaxElements)
+            {
+                GClassOfNextObject = nullptr;
+                throw std::bad_alloc();
+            }
+        } while (!NumElements.compare_exchange_weak(Index, Index + 1, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        GetOrCreateChunk(Index >> NumElementsPerChunkBits);
     }
-    else
+
+    FUObjectItem* Item = GetItemUnchecked(Index);
+    Item->Flags = GetInitialObjectFlags(Index);
+    Item->ClusterRootIndex = -1;
+    // NextFreeIndex는 건드리지 않는다 - 동시에 PopFreeIndex하는 스레드가 atomic_ref로 읽고 있을 수 있고,
+    // 확보된 슬롯의 링크는 다시 반납될 때(PushFreeIndex)까지 읽히지 않는다
+    Item->ClassListIndex = -1;
+    Item->Class = nullptr;
+    Item->Object = Object;
+
+    const UClass* Class = GClassOfNextObject;
+    GClassOfNextObject = nullptr;
+
     {
-        // 안되면 새 슬롯 생성
-        Index = (int32)ObjectList.size();
-        ObjectList.push_back(FUObjectItem(Object));
-        MaxObjectsEver = std::max(MaxObjectsEver, (int32)ObjectList.size());
+        std::lock_guard<std::mutex> Lock(ObjectListsMutex);
+
+        // 새 오브젝트는 젊은 세대에서 시작
+        YoungObjects.push_back(Index);
+
+        if (Class)
+        {
+            AddToClassList(Index, Class);
+        }
+        else
+        {
+            UnclassifiedObjects.push_back(Index);
+        }
     }
     
     return Index;
@@ -71,57 +234,66 @@ int32 FUObjectArray::AllocateUObjectIndexInternal(UObject* Object, bool bMergeDu
 
 void FUObjectArray::FreeUObjectIndex(UObject* Object)
 {
-    for (int32 i = 0; i < ObjectList.size(); ++i)
+    if (!Object)
+        return;
+
+    // InternalIndex로 바로 찾고, 슬롯이 실제로 이 오브젝트인지 확인 (GC가 먼저 비운 경우 중복 반환 방지)
+    const int32 Index = Object->GetInternalIndex();
+    if (Index >= 0 && Index < GetObjectArraySize() && GetItemUnchecked(Index)->Object == Object)
     {
-        if (ObjectList[i].Object == Object)
-        {
-            FreeUObjectIndexInternal(i);
-            break;
-        }
+        FreeUObjectIndexInternal(Index);
     }
 }
 
 void FUObjectArray::FreeUObjectIndexInternal(int32 Index)
 {
-    if (Index >= 0 && Index < ObjectList.size())
+    if (Index >= 0 && Index < GetObjectArraySize())
     {
-        FUObjectItem& Item = ObjectList[Index];
+        FUObjectItem& Item = *GetItemUnchecked(Index);
+        if (Item.Class)
+        {
+            std::lock_guard<std::mutex> Lock(ObjectListsMutex);
+            RemoveFromClassList(Index);
+        }
+
         Item.Object = nullptr;
         Item.Flags = 0;
         Item.ClusterRootIndex = -1;
-        Item.SerialNumber = 0;
+
+        // 이 슬롯을 가리키던 약한 참조를 모두 무효화 (시리얼 번호는 슬롯이 재사용되어도 초기화하지 않는다)
+        ++Item.SerialNumber;
         
-        ObjectAvailableList.push_back(Index);
+        PushFreeIndex(Index);
     }
 }
 
 UObject* FUObjectArray::GetObjectPtr(int32 Index) const
 {
-    if (Index >= 0 && Index < ObjectList.size())
-    {
-        const FUObjectItem& Item = ObjectList[Index];
-        return Item.IsValid() ? Item.Object : nullptr;
-    }
-    return nullptr;
+    const FUObjectItem* Item = GetObjectItemPtr(Index);
+    return (Item && Item->IsValid()) ? Item->Object : nullptr;
 }
 
 FUObjectItem* FUObjectArray::GetObjectItemPtr(int32 Index) const
 {
-    if (Index >= 0 && Index < ObjectList.size())
+    if (Index >= 0 && Index < GetObjectArraySize())
     {
-        return const_cast<FUObjectItem*>(&ObjectList[Index]);
+        // 다른 스레드가 슬롯만 확보하고 청크를 아직 게시하지 않았을 수 있다
+        FUObjectItem* Chunk = Chunks[ Index >> NumElementsPerChunkBits ].load(std::memory_order_acquire);
+        return Chunk ? Chunk + (Index & (NumElementsPerChunk - 1)) : nullptr;
     }
     return nullptr;
 }
 
 void FUObjectArray::GetAllObjects(TArray<UObject*>& OutObjects) const
 {
+    const int32 NumItems = GetObjectArraySize();
+
     OutObjects.clear();
-    OutObjects.reserve(ObjectList.size());
+    OutObjects.reserve(NumItems);
     
-    for (int32 i = 0; i < ObjectList.size(); ++i)
+    for (int32 i = 0; i < NumItems; ++i)
     {
-        const FUObjectItem& Item = ObjectList[i];
+        const FUObjectItem& Item = *GetItemUnchecked(i);
         if (Item.IsValid())
         {
             OutObjects.push_back(Item.Object);
@@ -129,6 +301,115 @@ void FUObjectArray::GetAllObjects(TArray<UObject*>& OutObjects) const
     }
 }
 
+void FUObjectArray::SetClassOfNextObject(const UClass* Class)
+{
+    GClassOfNextObject = Class;
+}
+
+void FUObjectArray::AddToClassList(int32 Index, const UClass* Class)
+{
+    TArray<int32>& ClassObjects = ObjectsByClass[ Class ];
+
+    FUObjectItem& Item = *GetItemUnchecked(Index);
+    Item.Class = Class;
+    Item.ClassListIndex = static_cast<int32>(ClassObjects.size());
+    ClassObjects.push_back(Index);
+}
+
+void FUObjectArray::RemoveFromClassList(int32 Index)
+{
+    FUObjectItem& Item = *GetItemUnchecked(Index);
+    TArray<int32>& ClassObjects = ObjectsByClass[ Item.Class ];
+
+    // 마지막 원소를 빈 자리로 옮겨 O(1) 제거
+    const int32 LastIndex = ClassObjects.back();
+    ClassObjects[ Item.ClassListIndex ] = LastIndex;
+    GetItemUnchecked(LastIndex)->ClassListIndex = Item.ClassListIndex;
+    ClassObjects.pop_back();
+
+    Item.Class = nullptr;
+    Item.ClassListIndex = -1;
+}
+
+void FUObjectArray::ClassifyPendingObjects()
+{
+    // 생성이 끝난 뒤에 호출되므로 GetClass()가 실제 클래스를 돌려준다
+    // 해제 후 재사용된 슬롯이 두 번 들어 있을 수 있으므로 이미 분류된 슬롯은 건너뛴다.
+    for (int32 Index : UnclassifiedObjects)
+    {
+        FUObjectItem& Item = *GetItemUnchecked(Index);
+        if (Item.IsValid() && !Item.Class)
+        {
+            AddToClassList(Index, Item.Object->GetClass());
+        }
+    }
+    UnclassifiedObjects.clear();
+}
+
+void FUObjectArray::GetObjectIndicesOfClass(const UClass* Class, TArray<int32>& OutIndices, bool bIncludeDerivedClasses)
+{
+    OutIndices.clear();
+    if (!Class)
+    {
+        return;
+    }
+
+    TArray<UClass*> DerivedClasses;
+    if (bIncludeDerivedClasses)
+    {
+        Class->GetAllChildClasses(DerivedClasses);
+    }
+
+    std::lock_guard<std::mutex> Lock(ObjectListsMutex);
+
+    if (!UnclassifiedObjects.empty())
+    {
+        ClassifyPendingObjects();
+    }
+
+    auto AppendClassObjects = [this, &OutIndices](const UClass* ListClass)
+    {
+        auto It = ObjectsByClass.find(ListClass);
+        if (It != ObjectsByClass.end())
+        {
+            OutIndices.insert(OutIndices.end(), It->second.begin(), It->second.end());
+        }
+    };
+
+    AppendClassObjects(Class);
+    for (const UClass* DerivedClass : DerivedClasses)
+    {
+        AppendClassObjects(DerivedClass);
+    }
+}
+
+int32 FUObjectArray::GetInitialObjectFlags(int32 Index) const
+{
+    int32 Flags = static_cast<int32>(EInternalObjectFlags::Young);
+
+    switch (Phase.load(std::memory_order_acquire))
+    {
+    case EGarbageCollectionPhase::MarkingRoots:
+    case EGarbageCollectionPhase::Marking:
+        // 마킹 도중 생성된 오브젝트는 이번 사이클에서 살린다 (생성 직후에는 참조가 없으므로 스캔할 필요 없음)
+        Flags |= static_cast<int32>(EInternalObjectFlags::Reachable);
+        break;
+
+    case EGarbageCollectionPhase::Sweeping:
+        // 아직 스윕하지 않은 구간이면 스윕이 지나가면서 마크를 지우도록 마킹해 둔다
+        if (Index >= SweepCursor.load(std::memory_order_acquire) && Index < SweepEnd)
+        {
+            Flags |= static_cast<int32>(EInternalObjectFlags::Reachable);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return Flags;
+}
+
 void FUObjectArray::PerformGarbageCollector()
 {
     // GC 비활성화 상태 체크
@@ -136,31 +417,390 @@ void FUObjectArray::PerformGarbageCollector()
         return;  // GC 실행하지 않고 종료
     }
 
-    TArray<int32> ObjectsToDelete;
-    
-    for (int32 i = 0; i < ObjectList.size(); ++i)
+    if (!IsGarbageCollecting())
     {
-        FUObjectItem& Item = ObjectList[i];
-        if (Item.IsValid() && Item.Object->IsPendingKill())
+        BeginMajorCollection();
+        InProgressStats.Type = EGarbageCollectionType::Full;
+    }
+
+    IncrementalGarbageCollect(std::numeric_limits<double>::infinity());
+}
+
+void FUObjectArray::BeginMajorCollection()
+{
+    // 마크는 매 사이클의 스윕(메이저)과 승격(마이너)에서 지워지므로 여기서 전체를 지울 필요가 없다
+    InProgressStats = FGarbageCollectionStats();
+    InProgressStats.Type = EGarbageCollectionType::Incremental;
+
+    RootScanCursor = 0;
+    SweepEnd = 0;
+    SweepCursor.store(0, std::memory_order_release);
+    PurgeCursor = 0;
+    GrayStack.clear();
+    PendingDestroy.clear();
+
+    Phase.store(EGarbageCollectionPhase::MarkingRoots, std::memory_order_release);
+}
+
+bool FUObjectArray::IncrementalGarbageCollect(double TimeBudgetMicroseconds)
+{
+    if (OpenForDisregardForGarbageCollection > 0)
+    {
+        return false;
+    }
+
+    const FGCClock::time_point StartTime = FGCClock::now();
+    const FGCClock::time_point Deadline = TimeBudgetMicroseconds < std::numeric_limits<double>::infinity()
+        ? StartTime + std::chrono::duration_cast<FGCClock::duration>(std::chrono::duration<double, std::micro>(TimeBudgetMicroseconds))
+        : FGCClock::time_point::max();
+
+    if (!IsGarbageCollecting())
+    {
+        BeginMajorCollection();
+    }
+
+    FReferenceCollector Collector(GrayStack, false);
+
+    int32 WorkSinceBudgetCheck = 0;
+    bool bOutOfTime = false;
+    auto IsOverBudget = [&]()
+    {
+        if (++WorkSinceBudgetCheck < WorkUnitsPerBudgetCheck)
+        {
+            return false;
+        }
+        WorkSinceBudgetCheck = 0;
+        return FGCClock::now() >= Deadline;
+    };
+
+    // 1. 루트 스캔 - 커서 이후에 루트가 된 오브젝트는 AddToRoot의 쓰기 배리어가 회색으로 만든다
+    if (Phase.load(std::memory_order_relaxed) == EGarbageCollectionPhase::MarkingRoots)
+    {
+        const int32 NumItems = GetObjectArraySize();
+        while (RootScanCursor < NumItems && !bOutOfTime)
+        {
+            FUObjectItem& Item = *GetItemUnchecked(RootScanCursor++);
+            if (Item.IsValid() && IsGarbageCollectionRoot(Item))
+            {
+                Collector.AddReferencedObject(Item.Object);
+            }
+            bOutOfTime = IsOverBudget();
+        }
+
+        if (RootScanCursor >= NumItems)
         {
-            ObjectsToDelete.push_back(i);
+            Phase.store(EGarbageCollectionPhase::Marking, std::memory_order_release);
         }
     }
-    
-    for (int32 Index : ObjectsToDelete)
+
+    // 2. 마킹 - 회색 스택이 빌 때까지 참조를 따라간다
+    if (Phase.load(std::memory_order_relaxed) == EGarbageCollectionPhase::Marking && !bOutOfTime)
     {
-        FUObjectItem& Item = ObjectList[Index];
-        if (Item.IsValid())
+        while (!GrayStack.empty() && !bOutOfTime)
         {
-            UObject* ObjectToDelete = Item.Object;
-            FreeUObjectIndexInternal(Index);
-            
-            if (ObjectToDelete)
+            const int32 Index = GrayStack.back();
+            GrayStack.pop_back();
+
+            // 단계 사이에 직접 삭제된 오브젝트의 슬롯은 건너뛴다
+            FUObjectItem* Item = GetObjectItemPtr(Index);
+            if (Item && Item->IsValid() && Item->HasAnyFlags(EInternalObjectFlags::Reachable))
             {
-                delete ObjectToDelete;
+                Item->Object->AddReferencedObjects(Collector);
+                ++InProgressStats.NumReachable;
             }
+            bOutOfTime = IsOverBudget();
+        }
+
+        if (GrayStack.empty())
+        {
+            SweepEnd = GetObjectArraySize();
+            SweepCursor.store(0, std::memory_order_release);
+            Phase.store(EGarbageCollectionPhase::Sweeping, std::memory_order_release);
         }
     }
+
+    const FGCClock::time_point MarkEndTime = FGCClock::now();
+
+    // 3. 스윕 - 도달하지 못한 오브젝트를 PendingKill로 만들고 BeginDestroy 호출, 살아남은 오브젝트는 마크 해제
+    // 삭제는 모든 BeginDestroy가 끝난 뒤에 하므로 BeginDestroy에서 함께 수집될 오브젝트를 건드려도 안전하다.
+    if (Phase.load(std::memory_order_relaxed) == EGarbageCollectionPhase::Sweeping && !bOutOfTime)
+    {
+        int32 Index = SweepCursor.load(std::memory_order_relaxed);
+        while (Index < SweepEnd && !bOutOfTime)
+        {
+            FUObjectItem& Item = *GetItemUnchecked(Index);
+            if (Item.IsValid())
+            {
+                ++InProgressStats.NumObjects;
+                if (Item.HasAnyFlags(EInternalObjectFlags::Reachable))
+                {
+                    Item.ClearFlags(EInternalObjectFlags::Reachable);
+                }
+                else
+                {
+                    UObject* Object = Item.Object;
+                    Object->MarkPendingKill();
+                    Object->BeginDestroy();
+                    PendingDestroy.push_back({ Index, Item.SerialNumber });
+                }
+            }
+
+            SweepCursor.store(++Index, std::memory_order_release);
+            bOutOfTime = IsOverBudget();
+        }
+
+        if (Index >= SweepEnd)
+        {
+            PurgeCursor = 0;
+            Phase.store(EGarbageCollectionPhase::Purging, std::memory_order_release);
+        }
+    }
+
+    // 4. 삭제
+    bool bFinished = false;
+    if (Phase.load(std::memory_order_relaxed) == EGarbageCollectionPhase::Purging && !bOutOfTime)
+    {
+        const int32 NumPending = static_cast<int32>(PendingDestroy.size());
+        while (PurgeCursor < NumPending && !bOutOfTime)
+        {
+            // 스윕 이후 이미 삭제된 오브젝트는 슬롯의 시리얼 번호가 바뀌어 있으므로 건너뛴다
+            const FPendingDestroyObject& Pending = PendingDestroy[ PurgeCursor++ ];
+            FUObjectItem& Item = *GetItemUnchecked(Pending.Index);
+            if (Item.Object && Item.SerialNumber == Pending.SerialNumber)
+            {
+                UObject* Object = Item.Object;
+                FreeUObjectIndexInternal(Pending.Index);
+                delete Object;
+                ++InProgressStats.NumCollected;
+            }
+            bOutOfTime = IsOverBudget();
+        }
+
+        if (PurgeCursor >= NumPending)
+        {
+            // 비워진 슬랩을 반환
+            GUObjectAllocator.ReleaseEmptySlabs();
+            bFinished = true;
+        }
+    }
+
+    const FGCClock::time_point EndTime = FGCClock::now();
+    const double PauseMs = ToMilliseconds(EndTime - StartTime);
+
+    InProgressStats.MarkTimeMs += ToMilliseconds(MarkEndTime - StartTime);
+    InProgressStats.SweepTimeMs += ToMilliseconds(EndTime - MarkEndTime);
+    InProgressStats.PauseTimeMs += PauseMs;
+    InProgressStats.MaxPauseTimeMs = std::max(InProgressStats.MaxPauseTimeMs, PauseMs);
+    ++InProgressStats.NumSteps;
+    RecordPause(PauseMs);
+
+    if (bFinished)
+    {
+        FinishMajorCollection();
+    }
+    return bFinished;
+}
+
+void FUObjectArray::FinishMajorCollection()
+{
+    // 전체를 검사했으므로 살아남은 오브젝트는 모두 오래된 세대로 승격 (정지형/증분 공통)
+    ClearGenerations();
+
+    PendingDestroy.clear();
+    PurgeCursor = 0;
+    TimeSinceLastMajorCollection = 0.0f;
+    LastGarbageCollectionStats = InProgressStats;
+
+    Phase.store(EGarbageCollectionPhase::Idle, std::memory_order_release);
+}
+
+void FUObjectArray::CollectYoungGeneration()
+{
+    if (OpenForDisregardForGarbageCollection > 0 || IsGarbageCollecting())
+    {
+        return;
+    }
+
+    const FGCClock::time_point StartTime = FGCClock::now();
+
+    FGarbageCollectionStats Stats;
+    Stats.Type = EGarbageCollectionType::Young;
+    Stats.NumSteps = 1;
+
+    // 이번 수집 중(BeginDestroy 등)에 생성되는 오브젝트는 다음 마이너 GC 대상
+    TArray<int32> YoungIndices;
+    {
+        std::lock_guard<std::mutex> Lock(ObjectListsMutex);
+        YoungIndices.swap(YoungObjects);
+    }
+
+    FMemMark Mark(FMemStack::Get());
+
+    // 1. 마킹 - 루트는 젊은 루트 오브젝트(루트 셋, 최상위)와 오래된 오브젝트가 참조하는 젊은 오브젝트(RememberedSet)
+    // 오래된 오브젝트는 살아 있다고 보고 따라가지 않는다.
+    FReferenceCollector Collector(GrayStack, true);
+
+    for (int32 Index : YoungIndices)
+    {
+        FUObjectItem& Item = *GetItemUnchecked(Index);
+        if (Item.IsValid() && Item.HasAnyFlags(EInternalObjectFlags::Young) && IsGarbageCollectionRoot(Item))
+        {
+            Collector.AddReferencedObject(Item.Object);
+        }
+    }
+
+    for (int32 Index : RememberedSet)
+    {
+        FUObjectItem& Item = *GetItemUnchecked(Index);
+        if (Item.IsValid() && Item.HasAnyFlags(EInternalObjectFlags::Remembered))
+        {
+            Item.ClearFlags(EInternalObjectFlags::Remembered);
+            Collector.AddReferencedObject(Item.Object);
+        }
+    }
+    RememberedSet.clear();
+
+    while (!GrayStack.empty())
+    {
+        const int32 Index = GrayStack.back();
+        GrayStack.pop_back();
+        GetItemUnchecked(Index)->Object->AddReferencedObjects(Collector);
+        ++Stats.NumReachable;
+    }
+
+    const FGCClock::time_point MarkEndTime = FGCClock::now();
+
+    // 2. 스윕 - 살아남은 젊은 오브젝트는 승격, 나머지는 수집
+    // 같은 슬롯이 목록에 두 번 있을 수 있으므로(해제 후 재사용) Young 플래그를 지워 한 번만 처리한다.
+    TArray<UObject*, TMemStackAllocator<UObject*>> ObjectsToDelete;
+    for (int32 Index : YoungIndices)
+    {
+        FUObjectItem& Item = *GetItemUnchecked(Index);
+        if (!Item.IsValid() || !Item.HasAnyFlags(EInternalObjectFlags::Young))
+        {
+            continue;
+        }
+
+        ++Stats.NumObjects;
+        Item.ClearFlags(EInternalObjectFlags::Young);
+
+        if (Item.HasAnyFlags(EInternalObjectFlags::Reachable))
+        {
+            Item.ClearFlags(EInternalObjectFlags::Reachable);
+        }
+        else
+        {
+            ObjectsToDelete.push_back(Item.Object);
+        }
+    }
+
+    for (UObject* Object : ObjectsToDelete)
+    {
+        Object->BeginDestroy();
+    }
+
+    for (UObject* Object : ObjectsToDelete)
+    {
+        FreeUObjectIndexInternal(Object->GetInternalIndex());
+        delete Object;
+    }
+
+    Stats.NumCollected = static_cast<int32>(ObjectsToDelete.size());
+
+    const FGCClock::time_point EndTime = FGCClock::now();
+    Stats.MarkTimeMs = ToMilliseconds(MarkEndTime - StartTime);
+    Stats.SweepTimeMs = ToMilliseconds(EndTime - MarkEndTime);
+    Stats.PauseTimeMs = ToMilliseconds(EndTime - StartTime);
+    Stats.MaxPauseTimeMs = Stats.PauseTimeMs;
+    LastGarbageCollectionStats = Stats;
+    RecordPause(Stats.PauseTimeMs);
+}
+
+void FUObjectArray::TickGarbageCollection(float DeltaTime)
+{
+    if (OpenForDisregardForGarbageCollection > 0)
+    {
+        return;
+    }
+
+    TimeSinceLastMajorCollection += DeltaTime;
+
+    // 진행 중인 메이저 GC가 있으면 이어서 진행 (그동안 마이너 GC는 하지 않는다)
+    if (IsGarbageCollecting())
+    {
+        IncrementalGarbageCollect(GarbageCollectionSettings.TimeBudgetMicroseconds);
+        return;
+    }
+
+    int32 NumYoungObjects = 0;
+    {
+        std::lock_guard<std::mutex> Lock(ObjectListsMutex);
+        NumYoungObjects = static_cast<int32>(YoungObjects.size());
+    }
+
+    if (NumYoungObjects >= GarbageCollectionSettings.YoungGenerationThreshold)
+    {
+        CollectYoungGeneration();
+    }
+    else if (TimeSinceLastMajorCollection >= GarbageCollectionSettings.MajorCollectionInterval)
+    {
+        IncrementalGarbageCollect(GarbageCollectionSettings.TimeBudgetMicroseconds);
+    }
+}
+
+void FUObjectArray::WriteBarrier(UObject* Owner, UObject* Referenced)
+{
+    if (!Referenced)
+    {
+        return;
+    }
+
+    const int32 Index = Referenced->GetInternalIndex();
+    FUObjectItem* Item = GetObjectItemPtr(Index);
+    if (!Item || Item->Object != Referenced)
+    {
+        return;
+    }
+
+    // 마킹 중에 이미 스캔한 오브젝트가 흰 오브젝트를 가리키게 되면 놓치므로 대상을 회색으로 만든다
+    const EGarbageCollectionPhase CurrentPhase = Phase.load(std::memory_order_acquire);
+    if (CurrentPhase == EGarbageCollectionPhase::MarkingRoots || CurrentPhase == EGarbageCollectionPhase::Marking)
+    {
+        FReferenceCollector(GrayStack, false).AddReferencedObject(Referenced);
+    }
+
+    // 오래된 오브젝트 -> 젊은 오브젝트 참조는 마이너 GC의 루트가 된다
+    if (Owner && Item->HasAnyFlags(EInternalObjectFlags::Young) && !Item->HasAnyFlags(EInternalObjectFlags::Remembered))
+    {
+        const FUObjectItem* OwnerItem = GetObjectItemPtr(Owner->GetInternalIndex());
+        if (OwnerItem && OwnerItem->Object == Owner && !OwnerItem->HasAnyFlags(EInternalObjectFlags::Young))
+        {
+            Item->SetFlags(EInternalObjectFlags::Remembered);
+            RememberedSet.push_back(Index);
+        }
+    }
+}
+
+void FUObjectArray::ClearGenerations()
+{
+    std::lock_guard<std::mutex> Lock(ObjectListsMutex);
+
+    for (int32 Index : YoungObjects)
+    {
+        GetItemUnchecked(Index)->ClearFlags(EInternalObjectFlags::Young);
+    }
+    for (int32 Index : RememberedSet)
+    {
+        GetItemUnchecked(Index)->ClearFlags(EInternalObjectFlags::Remembered);
+    }
+
+    YoungObjects.clear();
+    RememberedSet.clear();
+}
+
+void FUObjectArray::RecordPause(double PauseMs)
+{
+    PauseHistogram.AddPause(PauseMs * 1000.0);
 }
 
 void FUObjectArray::MarkAsGarbage(UObject* Object)
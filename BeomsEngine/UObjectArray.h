@@ -2,22 +2,41 @@
 #include "Types.h"
 #include "ObjectMacros.h"
 #include "Array.h"
+#include "Map.h"
+#include "GarbageCollection.h"
 #include <mutex>
+#include <atomic>
 
 class UObject;
 
+// FUObjectItem::Flags에 저장되는 내부 플래그
+enum class EInternalObjectFlags : int32
+{
+    None        = 0,
+    RootSet     = 1 << 0,   // 참조가 없어도 GC에서 해제되지 않음
+    Reachable   = 1 << 1,   // GC 마킹 단계에서 루트로부터 도달함
+    Young       = 1 << 2,   // 아직 마이너 GC를 한 번도 통과하지 않은 오브젝트
+    Remembered  = 1 << 3,   // 오래된 오브젝트가 참조하는 젊은 오브젝트 (RememberedSet에 등록됨)
+};
+
 struct FUObjectItem
 {
     UObject* Object;
     int32 Flags;            // 객체 상태 관리
     int32 ClusterRootIndex; // 객체 클러스터링 (그룹 GC)
-    int32 SerialNumber;     // 객체 버전 관리 (약한 참조?)
+    int32 SerialNumber;     // 슬롯이 해제될 때마다 증가 - 약한 참조(FWeakObjectPtr)가 재사용된 슬롯을 구분하는 데 사용
+    int32 NextFreeIndex;    // 빈 슬롯일 때 free list의 다음 인덱스 (std::atomic_ref로 접근)
+    int32 ClassListIndex;   // 클래스별 목록에서의 위치 (O(1) 제거용)
+    const UClass* Class;    // 클래스별 목록에 등록된 클래스, 아직 분류 전이면 nullptr
 
     FUObjectItem()
         : Object(nullptr)
         , Flags(0)
         , ClusterRootIndex(-1)
         , SerialNumber(0)
+        , NextFreeIndex(-1)
+        , ClassListIndex(-1)
+        , Class(nullptr)
     {
     }
 
@@ -26,19 +45,38 @@ struct FUObjectItem
         , Flags(0)
         , ClusterRootIndex(-1)
         , SerialNumber(0)
+        , NextFreeIndex(-1)
+        , ClassListIndex(-1)
+        , Class(nullptr)
     {
     }
 
     bool IsValid() const { return Object != nullptr; }
     bool IsValidLowLevel() const { return Object != nullptr; }
+
+    bool HasAnyFlags(EInternalObjectFlags InFlags) const { return (Flags & static_cast<int32>(InFlags)) != 0; }
+    void SetFlags(EInternalObjectFlags InFlags) { Flags |= static_cast<int32>(InFlags); }
+    void ClearFlags(EInternalObjectFlags InFlags) { Flags &= ~static_cast<int32>(InFlags); }
 };
 
+// 청크 단위 UObject 배열
+// - 고정 크기 청크는 한 번 만들어지면 이동하지 않으므로 FUObjectItem 포인터가 항상 유효하다.
+// - 슬롯 확보(원자적 증가)와 반납(태그 붙은 lock-free 스택)은 잠금 없이 어느 스레드에서나 가능하다.
+// - GC와 전체 순회는 등록/해제가 동시에 일어나지 않는 게임 스레드에서 수행한다고 가정한다.
 class FUObjectArray
 {
 public:
+    static constexpr int32 NumElementsPerChunkBits = 14;
+    static constexpr int32 NumElementsPerChunk = 1 << NumElementsPerChunkBits;
+    static constexpr int32 MaxChunks = 1024;
+
     FUObjectArray();
     ~FUObjectArray();
 
+    // 최대 오브젝트 수를 정하고 그만큼의 청크를 미리 할당 (첫 오브젝트 생성 전에 호출)
+    void AllocateObjectPool(int32 InMaxObjects);
+
+    // 배열이 가득 차면(MaxElements) std::bad_alloc을 던진다
     int32 AllocateUObjectIndex(UObject* Object, bool bMergeDuplicates = true);
     void FreeUObjectIndex(UObject* Object);
     
@@ -46,45 +84,143 @@ public:
 	UObject* operator[](int32 Index) const { return GetObjectPtr(Index); }
 
     FUObjectItem* GetObjectItemPtr(int32 Index) const;
-	FUObjectItem& GetObjectItem(int32 Index) { return ObjectList[ Index ]; }
+	FUObjectItem& GetObjectItem(int32 Index) { return *GetItemUnchecked(Index); }
     
-    int32 GetMaxObjectsEver() const { return MaxObjectsEver; }
-    int32 GetObjectArraySize() const { return (int32)ObjectList.size(); }
-    int32 GetObjectArrayMax() const { return MaxObjectsEver; }
+    int32 GetMaxObjectsEver() const { return NumElements.load(std::memory_order_acquire); }
+    int32 GetObjectArraySize() const { return NumElements.load(std::memory_order_acquire); }
+    int32 GetObjectArrayMax() const { return MaxElements; }
     
     void GetAllObjects(TArray<UObject*>& OutObjects) const;
     
+    // 클래스별 목록
+    // 새 오브젝트는 UClass::CreateDefaultObject가 알려준 클래스의 목록에 바로 들어가고,
+    // 직접 new로 만든 오브젝트는 다음 조회 때 GetClass()로 분류된다.
+    // 조회 비용은 전체 오브젝트 수가 아니라 해당 클래스(와 자식 클래스)의 오브젝트 수에 비례한다.
+    static void SetClassOfNextObject(const UClass* Class);
+
+    // Class(bIncludeDerivedClasses면 자식 클래스 포함) 오브젝트의 인덱스를 복사 (PendingKill 포함)
+    void GetObjectIndicesOfClass(const UClass* Class, TArray<int32>& OutIndices, bool bIncludeDerivedClasses = true);
+
     template<typename T>
-    void GetObjectsOfClass(TArray<T*>& OutObjects) const
+    void GetObjectsOfClass(TArray<T*>& OutObjects)
     {
+        TArray<int32> Indices;
+        GetObjectIndicesOfClass(T::GetStaticClass(), Indices);
+
         OutObjects.clear();
-        for (int32 i = 0; i < ObjectList.size(); ++i)
+        OutObjects.reserve(Indices.size());
+        for (int32 Index : Indices)
         {
-            const FUObjectItem& Item = ObjectList[i];
-            if (Item.IsValid())
+            if (UObject* Object = GetObjectPtr(Index))
             {
-                if (Item.Object->IsA<T>())
-                {
-                    T* CastedObject = static_cast<T*>(Item.Object);
-                    OutObjects.push_back(CastedObject);
-                }
+                OutObjects.push_back(static_cast<T*>(Object));
             }
         }
     }
 
     // Mark-and-Sweep
+    // 루트(RootSet 플래그 - 월드는 생성 시 스스로 등록 - 또는 Outer가 없는 최상위 오브젝트)에서
+    // AddReferencedObjects로 도달할 수 없거나 PendingKill인 오브젝트를 모두 해제한다.
+    // Outer가 있는 오브젝트를 GC 밖의 코드만 쥐고 있다면 AddToRoot로 살려 두어야 한다.
+    // 진행 중인 증분 GC가 있으면 그 사이클을 끝까지 마친다.
     void PerformGarbageCollector();
     void MarkAsGarbage(UObject* Object);
 
+    // 증분/세대 GC (게임 스레드 전용)
+    // UWorld::Tick에서 매 프레임 호출 - 진행 중인 메이저 GC를 예산만큼 진행하거나,
+    // 젊은 오브젝트가 쌓였으면 마이너 GC를, 주기가 되었으면 새 메이저 GC를 시작한다.
+    void TickGarbageCollection(float DeltaTime);
+
+    // 메이저 GC를 TimeBudgetMicroseconds 동안 진행하고 사이클이 끝났으면 true
+    bool IncrementalGarbageCollect(double TimeBudgetMicroseconds);
+
+    // 젊은 오브젝트만 대상으로 하는 마이너 GC (정지형, 메이저 GC 진행 중에는 건너뜀)
+    void CollectYoungGeneration();
+
+    // 쓰기 배리어 - Owner가 Referenced를 새로 참조하게 될 때 호출
+    // 마킹 중이면 Referenced를 회색으로 만들고, 오래된 Owner가 젊은 Referenced를 가리키면 RememberedSet에 넣는다.
+    void WriteBarrier(UObject* Owner, UObject* Referenced);
+
+    bool IsGarbageCollecting() const { return Phase.load(std::memory_order_acquire) != EGarbageCollectionPhase::Idle; }
+    EGarbageCollectionPhase GetGarbageCollectionPhase() const { return Phase.load(std::memory_order_acquire); }
+    int32 GetNumYoungObjects() const { return static_cast<int32>(YoungObjects.size()); }
+
+    FGarbageCollectionSettings& GetGarbageCollectionSettings() { return GarbageCollectionSettings; }
+    const FGarbageCollectionStats& GetLastGarbageCollectionStats() const { return LastGarbageCollectionStats; }
+    const FGarbageCollectionPauseHistogram& GetPauseHistogram() const { return PauseHistogram; }
+    void ResetPauseHistogram() { PauseHistogram.Reset(); }
+
 private:
-    TArray<FUObjectItem> ObjectList;
-    TArray<int32> ObjectAvailableList;
-    
-    int32 MaxObjectsEver;
+    // 청크 포인터 - 한 번 게시되면 프로그램 종료까지 유지
+    std::atomic<FUObjectItem*> Chunks[ MaxChunks ];
+
+    // 지금까지 확보된 슬롯 수 (다음 새 슬롯 인덱스)
+    std::atomic<int32> NumElements;
+    int32 MaxElements;
+
+    // 반납된 슬롯 스택의 머리 (상위 32비트 = ABA 방지 태그, 하위 32비트 = 인덱스, -1이면 비어 있음)
+    std::atomic<uint64> FreeListHead;
+
     int32 OpenForDisregardForGarbageCollection; // GC 무시 카운터
+
+    FGarbageCollectionStats LastGarbageCollectionStats;
+    FGarbageCollectionStats InProgressStats;
+    FGarbageCollectionSettings GarbageCollectionSettings;
+    FGarbageCollectionPauseHistogram PauseHistogram;
+
+    // 메이저 GC 상태
+    std::atomic<EGarbageCollectionPhase> Phase;
+    int32 RootScanCursor;
+    std::atomic<int32> SweepCursor;             // 이 인덱스 이상은 아직 스윕되지 않음
+    int32 SweepEnd;                             // 스윕 시작 시점의 배열 크기
+    int32 PurgeCursor;
+    FReferenceCollector::FObjectStack GrayStack; // 마킹됐지만 아직 참조를 따라가지 않은 오브젝트
+    // BeginDestroy까지 끝나고 삭제를 기다리는 오브젝트
+    // 단계 사이에 직접 delete되고 슬롯이 재사용될 수 있으므로 포인터 대신 인덱스와 시리얼 번호로 기억한다
+    struct FPendingDestroyObject
+    {
+        int32 Index;
+        int32 SerialNumber;
+    };
+    TArray<FPendingDestroyObject> PendingDestroy;
+    float TimeSinceLastMajorCollection;
+
+    // 세대 상태
+    TArray<int32> YoungObjects;
+    TArray<int32> RememberedSet;
+
+    // 클래스별 오브젝트 인덱스 목록과 아직 분류되지 않은 오브젝트
+    TMap<const UClass*, TArray<int32>> ObjectsByClass;
+    TArray<int32> UnclassifiedObjects;
+
+    // 등록/해제는 어느 스레드에서나 일어나므로 YoungObjects와 클래스별 목록은 ObjectListsMutex로 보호
+    std::mutex ObjectListsMutex;
+
+    FUObjectItem* GetItemUnchecked(int32 Index) const
+    {
+        return Chunks[ Index >> NumElementsPerChunkBits ].load(std::memory_order_acquire) + (Index & (NumElementsPerChunk - 1));
+    }
+
+    FUObjectItem* GetOrCreateChunk(int32 ChunkIndex);
+
+    int32 PopFreeIndex();
+    void PushFreeIndex(int32 Index);
     
     int32 AllocateUObjectIndexInternal(UObject* Object, bool bMergeDuplicates);
     void FreeUObjectIndexInternal(int32 Index);
+
+    // ObjectListsMutex를 잡은 상태에서 호출
+    void AddToClassList(int32 Index, const UClass* Class);
+    void RemoveFromClassList(int32 Index);
+    void ClassifyPendingObjects();
+
+    // 진행 중인 GC 단계에 맞춰 새 오브젝트의 초기 플래그를 정한다
+    int32 GetInitialObjectFlags(int32 Index) const;
+
+    void BeginMajorCollection();
+    void FinishMajorCollection();
+    void ClearGenerations();
+    void RecordPause(double PauseMs);
 };
 
 extern FUObjectArray GUObjectArray;
@@ -0,0 +1,138 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "ObjectInitializer.h"
+#include "StaticMeshComponent.h"
+
+// UObject 생성/소멸 - GUObjectArray 인덱스 할당/해제 비용
+IMPLEMENT_BENCHMARK(UObjectSpawnDestroy)
+{
+    const int32 NumObjects = 100000;
+
+    TArray<UObject*> Objects;
+    Objects.Reserve(NumObjects);
+
+    double BestSpawn = 1e30;
+    double BestDestroy = 1e30;
+    for (int32 Run = 0; Run < 5; ++Run)
+    {
+        const double SpawnStart = FBenchmark::NowMicroseconds();
+        for (int32 Index = 0; Index < NumObjects; ++Index)
+        {
+            Objects.Add(NewObject<UObject>());
+        }
+        const double DestroyStart = FBenchmark::NowMicroseconds();
+        for (UObject* Object : Objects)
+        {
+            delete Object;
+        }
+        const double End = FBenchmark::NowMicroseconds();
+        Objects.Reset();
+
+        BestSpawn = std::min(BestSpawn, DestroyStart - SpawnStart);
+        BestDestroy = std::min(BestDestroy, End - DestroyStart);
+    }
+
+    FBenchmark::Report("%d NewObject<UObject>   %8.2f ms\n", NumObjects, BestSpawn / 1000.0);
+    FBenchmark::Report("%d delete               %8.2f ms\n", NumObjects, BestDestroy / 1000.0);
+}
+
+namespace
+{
+    // 조상 배열 이전의 방식 - SuperClass를 따라 올라가며 비교 (비교용)
+    bool IsChildOfBySuperChain(const UClass* Class, const UClass* SomeBase)
+    {
+        for (const UClass* Current = Class; Current; Current = Current->GetSuperClass())
+        {
+            if (Current == SomeBase)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+// IsA/Cast - 상속 깊이와 무관한 조상 배열 비교
+IMPLEMENT_BENCHMARK(UObjectCast)
+{
+    const int32 NumObjects = 1000;
+    const int32 NumCasts = 1000000;
+
+    // 깊이가 서로 다른 다섯 클래스의 인스턴스를 섞어 둔다
+    TArray<UObject*> Objects;
+    for (int32 Index = 0; Index < NumObjects; ++Index)
+    {
+        switch (Index % 5)
+        {
+        case 0: Objects.Add(NewObject<UActorComponent>()); break;
+        case 1: Objects.Add(NewObject<USceneComponent>()); break;
+        case 2: Objects.Add(NewObject<UPrimitiveComponent>()); break;
+        case 3: Objects.Add(NewObject<UMeshComponent>()); break;
+        default: Objects.Add(NewObject<UStaticMeshComponent>()); break;
+        }
+    }
+
+    const UClass* TargetClasses[ 5 ] =
+    {
+        UActorComponent::GetStaticClass(),
+        USceneComponent::GetStaticClass(),
+        UPrimitiveComponent::GetStaticClass(),
+        UMeshComponent::GetStaticClass(),
+        UStaticMeshComponent::GetStaticClass(),
+    };
+
+    // 나눗셈/나머지 없이 (대상 클래스, 오브젝트) 쌍을 순서대로 훑어 비교 비용만 남긴다
+    const int32 NumRepeats = NumCasts / (NumObjects * 5);
+    int32 NumHits = 0;
+    const TPair<double, double> ChainTimes = FBenchmark::MeasureBestInterleaved(9, [&]()
+    {
+        for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (const UClass* TargetClass : TargetClasses)
+            {
+                for (const UObject* Object : Objects)
+                {
+                    NumHits += IsChildOfBySuperChain(Object->GetClass(), TargetClass);
+                }
+            }
+        }
+    }, [&]()
+    {
+        for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (const UClass* TargetClass : TargetClasses)
+            {
+                for (const UObject* Object : Objects)
+                {
+                    NumHits += Object->IsA(TargetClass);
+                }
+            }
+        }
+    });
+    const double SuperChainTime = ChainTimes.first;
+    const double IsATime = ChainTimes.second;
+    const double CastTime = FBenchmark::MeasureBest(9, [&]()
+    {
+        for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (UObject* Object : Objects)
+            {
+                NumHits += Cast<UActorComponent>(Object) != nullptr;
+                NumHits += Cast<USceneComponent>(Object) != nullptr;
+                NumHits += Cast<UPrimitiveComponent>(Object) != nullptr;
+                NumHits += Cast<UMeshComponent>(Object) != nullptr;
+                NumHits += Cast<UStaticMeshComponent>(Object) != nullptr;
+            }
+        }
+    });
+    FBenchmark::Consume(NumHits);
+
+    FBenchmark::Report("%d IsChildOf (super chain walk)  %7.2f ms\n", NumCasts, SuperChainTime / 1000.0);
+    FBenchmark::Report("%d IsA (ancestor chain)          %7.2f ms\n", NumCasts, IsATime / 1000.0);
+    FBenchmark::Report("%d Cast<T> (ancestor chain)      %7.2f ms\n", NumCasts, CastTime / 1000.0);
+
+    for (UObject* Object : Objects)
+    {
+        delete Object;
+    }
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+// T와 그 자식 클래스의 오브젝트만 방문하는 반복자
+// 시작할 때 GUObjectArray의 클래스별 목록에서 인덱스를 복사해 두므로 비용은 결과 수에 비례하고,
+// 순회 중에 오브젝트가 생성/해제되어도 안전하다 (해제되거나 다른 오브젝트로 재사용된 슬롯은 건너뜀).
 template <typename T>
 class TObjectIterator
 {
@@ -8,17 +11,14 @@ public:
 
 	TObjectIterator()
 		: Index(0)
-		, EndIndex(GUObjectArray.GetObjectArraySize())
 	{
+		GUObjectArray.GetObjectIndicesOfClass(T::GetStaticClass(), Indices);
 		Advance();
 	}
 
 	static TObjectIterator End()
 	{
-		TObjectIterator It;
-		It.Index = It.EndIndex;
-		It.CurrentObject = nullptr;
-		return It;
+		return TObjectIterator(EEndTag::End);
 	}
 
 	// 역참조
@@ -35,23 +35,29 @@ public:
 	// Bool context (for while/for conditions)
 	explicit operator bool() const { return CurrentObject != nullptr; }
 
-	// Range-for compatibility
-	bool operator!=(const TObjectIterator& InOther) const { return Index != InOther.Index; }
+	// Range-for compatibility - 끝에 도달하면 CurrentObject가 nullptr가 된다
+	bool operator!=(const TObjectIterator& InOther) const { return CurrentObject != InOther.CurrentObject; }
 
 private:
+	enum class EEndTag { End };
+
+	explicit TObjectIterator(EEndTag)
+		: Index(0)
+	{
+	}
+
 	void Advance()
 	{
 		CurrentObject = nullptr;
-		for (size_t i = Index; i < EndIndex; ++i)
+		for (; Index < Indices.size(); ++Index)
 		{
-			UObject* Object = GUObjectArray.GetObjectPtr(static_cast<int32>(i));
+			UObject* Object = GUObjectArray.GetObjectPtr(Indices[ Index ]);
 			if (Object && IsValidObject(Object))
 			{
 				auto* CastedObject = Cast<T>(Object);
 				if (CastedObject)
 				{
 					CurrentObject = CastedObject;
-					Index = i;
 					return;
 				}
 			}
@@ -74,8 +80,8 @@ private:
 		return true;
 	}
 
+	TArray<int32> Indices;
 	size_t Index;
-	size_t EndIndex;
 	T* CurrentObject = nullptr;
 };
 
@@ -0,0 +1,227 @@
+#include "pch.h"
+#include "VectorKernels.h"
+#include "Vertex.h"
+
+namespace
+{
+    float ReduceMin(const VectorRegister& Vec)
+    {
+        float Lanes[ 4 ];
+        VectorStore(Vec, Lanes);
+        return std::min(std::min(Lanes[ 0 ], Lanes[ 1 ]), std::min(Lanes[ 2 ], Lanes[ 3 ]));
+    }
+
+    float ReduceMax(const VectorRegister& Vec)
+    {
+        float Lanes[ 4 ];
+        VectorStore(Vec, Lanes);
+        return std::max(std::max(Lanes[ 0 ], Lanes[ 1 ]), std::max(Lanes[ 2 ], Lanes[ 3 ]));
+    }
+}
+
+void FPositionStream::SetFromVertices(const TArray<FVertex>& Vertices)
+{
+    SetNum(Vertices.Num());
+    FVectorKernels::DeinterleavePositions(Vertices.GetData(), Vertices.Num(), X.GetData(), Y.GetData(), Z.GetData());
+}
+
+void FVectorKernels::DeinterleavePositions(const FVertex* Vertices, int32 Count, float* OutX, float* OutY, float* OutZ)
+{
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FVector& Position = Vertices[ i ].Position;
+        OutX[ i ] = Position.X;
+        OutY[ i ] = Position.Y;
+        OutZ[ i ] = Position.Z;
+    }
+}
+
+void FVectorKernels::ComputeMinMax(const float* X, const float* Y, const float* Z, int32 Count, FVector& OutMin, FVector& OutMax)
+{
+    FVector Min(X[ 0 ], Y[ 0 ], Z[ 0 ]);
+    FVector Max = Min;
+
+    int32 i = 0;
+    const int32 VectorCount = Count & ~3;
+    if (VectorCount > 0)
+    {
+        VectorRegister MinX = VectorLoad(X), MaxX = MinX;
+        VectorRegister MinY = VectorLoad(Y), MaxY = MinY;
+        VectorRegister MinZ = VectorLoad(Z), MaxZ = MinZ;
+
+        for (i = 4; i < VectorCount; i += 4)
+        {
+            const VectorRegister PX = VectorLoad(X + i);
+            const VectorRegister PY = VectorLoad(Y + i);
+            const VectorRegister PZ = VectorLoad(Z + i);
+            MinX = VectorMin(MinX, PX);
+            MaxX = VectorMax(MaxX, PX);
+            MinY = VectorMin(MinY, PY);
+            MaxY = VectorMax(MaxY, PY);
+            MinZ = VectorMin(MinZ, PZ);
+            MaxZ = VectorMax(MaxZ, PZ);
+        }
+
+        Min = FVector(ReduceMin(MinX), ReduceMin(MinY), ReduceMin(MinZ));
+        Max = FVector(ReduceMax(MaxX), ReduceMax(MaxY), ReduceMax(MaxZ));
+    }
+
+    for (; i < Count; ++i)
+    {
+        Min.X = std::min(Min.X, X[ i ]);
+        Min.Y = std::min(Min.Y, Y[ i ]);
+        Min.Z = std::min(Min.Z, Z[ i ]);
+        Max.X = std::max(Max.X, X[ i ]);
+        Max.Y = std::max(Max.Y, Y[ i ]);
+        Max.Z = std::max(Max.Z, Z[ i ]);
+    }
+
+    OutMin = Min;
+    OutMax = Max;
+}
+
+float FVectorKernels::ComputeMaxDistanceSquared(const float* X, const float* Y, const float* Z, int32 Count, const FVector& Center)
+{
+    float MaxDistanceSquared = 0.0f;
+
+    int32 i = 0;
+    const int32 VectorCount = Count & ~3;
+    if (VectorCount > 0)
+    {
+        const VectorRegister CX = VectorSetFloat1(Center.X);
+        const VectorRegister CY = VectorSetFloat1(Center.Y);
+        const VectorRegister CZ = VectorSetFloat1(Center.Z);
+        VectorRegister MaxDistance = VectorZero();
+
+        for (; i < VectorCount; i += 4)
+        {
+            const VectorRegister DX = VectorSubtract(VectorLoad(X + i), CX);
+            const VectorRegister DY = VectorSubtract(VectorLoad(Y + i), CY);
+            const VectorRegister DZ = VectorSubtract(VectorLoad(Z + i), CZ);
+            const VectorRegister DistanceSquared = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+            MaxDistance = VectorMax(MaxDistance, DistanceSquared);
+        }
+
+        MaxDistanceSquared = ReduceMax(MaxDistance);
+    }
+
+    for (; i < Count; ++i)
+    {
+        const float DX = X[ i ] - Center.X;
+        const float DY = Y[ i ] - Center.Y;
+        const float DZ = Z[ i ] - Center.Z;
+        MaxDistanceSquared = std::max(MaxDistanceSquared, DX * DX + DY * DY + DZ * DZ);
+    }
+
+    return MaxDistanceSquared;
+}
+
+void FVectorKernels::TransformPositions(const FMatrix& Matrix, const float* InX, const float* InY, const float* InZ,
+    float* OutX, float* OutY, float* OutZ, int32 Count)
+{
+    const FMatrix& M = Matrix;
+
+    int32 i = 0;
+    const int32 VectorCount = Count & ~3;
+    if (VectorCount > 0)
+    {
+        // 행렬의 위 세 행을 성분별로 복제해 둔다 (12개 레지스터)
+        VectorRegister Row[ 3 ][ 4 ];
+        for (int32 r = 0; r < 3; ++r)
+        {
+            for (int32 c = 0; c < 4; ++c)
+            {
+                Row[ r ][ c ] = VectorSetFloat1(M.M[r][c]);
+            }
+        }
+
+        for (; i < VectorCount; i += 4)
+        {
+            const VectorRegister PX = VectorLoad(InX + i);
+            const VectorRegister PY = VectorLoad(InY + i);
+            const VectorRegister PZ = VectorLoad(InZ + i);
+
+            VectorRegister Result[ 3 ];
+            for (int32 r = 0; r < 3; ++r)
+            {
+                Result[ r ] = VectorMultiplyAdd(PX, Row[ r ][ 0 ], Row[ r ][ 3 ]);
+                Result[ r ] = VectorMultiplyAdd(PY, Row[ r ][ 1 ], Result[ r ]);
+                Result[ r ] = VectorMultiplyAdd(PZ, Row[ r ][ 2 ], Result[ r ]);
+            }
+
+            VectorStore(Result[ 0 ], OutX + i);
+            VectorStore(Result[ 1 ], OutY + i);
+            VectorStore(Result[ 2 ], OutZ + i);
+        }
+    }
+
+    for (; i < Count; ++i)
+    {
+        const float PX = InX[ i ];
+        const float PY = InY[ i ];
+        const float PZ = InZ[ i ];
+        OutX[ i ] = M.M[0][0] * PX + M.M[0][1] * PY + M.M[0][2] * PZ + M.M[0][3];
+        OutY[ i ] = M.M[1][0] * PX + M.M[1][1] * PY + M.M[1][2] * PZ + M.M[1][3];
+        OutZ[ i ] = M.M[2][0] * PX + M.M[2][1] * PY + M.M[2][2] * PZ + M.M[2][3];
+    }
+}
+
+void FVectorKernels::TransformBoxes(const FMatrix& Matrix, const FVector* InOrigins, const FVector* InExtents,
+    FVector* OutOrigins, FVector* OutExtents, int32 Count)
+{
+    // 열 벡터 규약이므로 열 j가 j축의 상이다
+    float Columns[ 16 ];
+    VectorMatrixTranspose(Columns, &Matrix.M[0][0]);
+
+    const VectorRegister C0 = VectorLoad(Columns + 0);
+    const VectorRegister C1 = VectorLoad(Columns + 4);
+    const VectorRegister C2 = VectorLoad(Columns + 8);
+    const VectorRegister C3 = VectorLoad(Columns + 12);
+    const VectorRegister AbsC0 = VectorAbs(C0);
+    const VectorRegister AbsC1 = VectorAbs(C1);
+    const VectorRegister AbsC2 = VectorAbs(C2);
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const float* Origin = &InOrigins[ i ].X;
+        const float* Extent = &InExtents[ i ].X;
+
+        VectorRegister NewOrigin = VectorMultiplyAdd(VectorLoadFloat1(Origin + 0), C0, C3);
+        NewOrigin = VectorMultiplyAdd(VectorLoadFloat1(Origin + 1), C1, NewOrigin);
+        NewOrigin = VectorMultiplyAdd(VectorLoadFloat1(Origin + 2), C2, NewOrigin);
+
+        // 변환된 박스의 각 축 반 크기 = 세 축 상의 해당 성분 절댓값 합
+        VectorRegister NewExtent = VectorMultiply(VectorLoadFloat1(Extent + 0), AbsC0);
+        NewExtent = VectorMultiplyAdd(VectorLoadFloat1(Extent + 1), AbsC1, NewExtent);
+        NewExtent = VectorMultiplyAdd(VectorLoadFloat1(Extent + 2), AbsC2, NewExtent);
+
+        VectorStoreFloat3(NewOrigin, &OutOrigins[ i ].X);
+        VectorStoreFloat3(NewExtent, &OutExtents[ i ].X);
+    }
+}
+
+float FVectorKernels::GetMaximumAxisScale(const FMatrix& Matrix)
+{
+    // 3x3 부분 A의 최대 특이값 = sqrt(A^T A의 최대 고유값)
+    // A^T A는 열끼리의 내적(그람 행렬)이고, 대칭이므로 고유값은 Gershgorin 원판 안에 있다:
+    //   최대 고유값 <= max_i (|c_i|^2 + sum_{j != i} |c_i . c_j|)
+    // 열끼리 직교하면(회전 * 스케일) 최대 열 길이와 같고, 전단이 있으면 열 길이보다 크게 잡힌다.
+    const FMatrix& M = Matrix;
+    float Gram[ 3 ][ 3 ];
+    for (int32 i = 0; i < 3; ++i)
+    {
+        for (int32 j = i; j < 3; ++j)
+        {
+            Gram[ i ][ j ] = M.M[0][i] * M.M[0][j] + M.M[1][i] * M.M[1][j] + M.M[2][i] * M.M[2][j];
+            Gram[ j ][ i ] = Gram[ i ][ j ];
+        }
+    }
+
+    float MaxEigenvalueBound = 0.0f;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const float RowBound = Gram[ i ][ i ] + std::abs(Gram[ i ][ (i + 1) % 3 ]) + std::abs(Gram[ i ][ (i + 2) % 3 ]);
+        MaxEigenvalueBound = std::max(MaxEigenvalueBound, RowBound);
+    }
+    return std::sqrt(MaxEigenvalueBound);
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "Types.h"
+#include "Containers.h"
+#include "Matrix.h"
+
+struct FVertex;
+
+// 위치 스트림 (SoA) - X, Y, Z 성분을 각각 연속 배열로 저장한다
+// 점 4개의 같은 성분이 한 레지스터에 바로 올라가므로 셔플 없이 4개씩 처리할 수 있다.
+struct FPositionStream
+{
+    TArray<float> X;
+    TArray<float> Y;
+    TArray<float> Z;
+
+    int32 Num() const { return X.Num(); }
+
+    void SetNum(int32 NewNum)
+    {
+        X.SetNum(NewNum);
+        Y.SetNum(NewNum);
+        Z.SetNum(NewNum);
+    }
+
+    void Set(int32 Index, const FVector& Position)
+    {
+        X[ Index ] = Position.X;
+        Y[ Index ] = Position.Y;
+        Z[ Index ] = Position.Z;
+    }
+
+    FVector Get(int32 Index) const
+    {
+        return FVector(X[ Index ], Y[ Index ], Z[ Index ]);
+    }
+
+    // 정점 배열에서 위치만 뽑아낸다 (정점을 한 번만 읽음)
+    void SetFromVertices(const TArray<FVertex>& Vertices);
+};
+
+// 위치 스트림과 바운딩에 대한 일괄 처리 커널
+// 모든 커널은 4개 단위로 SIMD 처리하고 나머지는 스칼라로 마무리한다.
+class FVectorKernels
+{
+public:
+    // 정점 배열(AoS)의 위치를 SoA 배열 셋으로 풀어 쓴다
+    static void DeinterleavePositions(const FVertex* Vertices, int32 Count, float* OutX, float* OutY, float* OutZ);
+
+    // 최소/최대 성분 (Count > 0이어야 한다)
+    static void ComputeMinMax(const float* X, const float* Y, const float* Z, int32 Count, FVector& OutMin, FVector& OutMax);
+
+    // Center에서 가장 먼 점까지의 거리 제곱
+    static float ComputeMaxDistanceSquared(const float* X, const float* Y, const float* Z, int32 Count, const FVector& Center);
+
+    // 아핀 변환 (W 나누기 없음) - In과 Out은 같은 배열이어도 된다
+    static void TransformPositions(const FMatrix& Matrix, const float* InX, const float* InY, const float* InZ,
+        float* OutX, float* OutY, float* OutZ, int32 Count);
+
+    // 중심/반 크기로 표현된 AABB들을 변환한 뒤 다시 감싸는 AABB (Arvo 방법)
+    // 새 반 크기 = |M의 3x3 부분| * 반 크기. 행렬은 아핀이어야 한다.
+    static void TransformBoxes(const FMatrix& Matrix, const FVector* InOrigins, const FVector* InExtents,
+        FVector* OutOrigins, FVector* OutExtents, int32 Count);
+
+    // 행렬이 임의의 벡터를 늘리는 최대 배율의 상한 (바운딩 스피어 반지름 변환용)
+    // 전단이 없으면 최대 축 배율과 같고, 전단이 있어도 실제 배율보다 작아지지 않는다.
+    static float GetMaximumAxisScale(const FMatrix& Matrix);
+};
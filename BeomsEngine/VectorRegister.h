@@ -0,0 +1,556 @@
+#pragma once
+#include "Types.h"
+#include <cmath>
+
+// 4개의 float를 한 번에 다루는 SIMD 레지스터와 연산 모음
+// - x86/x64에서는 SSE2 (__m128), 그 외 플랫폼에서는 같은 인터페이스의 스칼라 구현을 사용한다.
+// - /arch:AVX2 등으로 FMA가 켜져 있으면 VectorMultiplyAdd가 FMA 명령 하나로 바뀐다.
+// - 행렬 함수는 FMatrix::M과 같은 행 우선 float[16]을 받는다.
+#ifndef PLATFORM_ENABLE_VECTORINTRINSICS
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PLATFORM_ENABLE_VECTORINTRINSICS 1
+#else
+#define PLATFORM_ENABLE_VECTORINTRINSICS 0
+#endif
+#endif
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+
+#if defined(__FMA__) || defined(__AVX2__)
+#include <immintrin.h>
+#define PLATFORM_ENABLE_VECTORINTRINSICS_FMA 1
+#else
+#include <emmintrin.h>
+#define PLATFORM_ENABLE_VECTORINTRINSICS_FMA 0
+#endif
+
+typedef __m128 VectorRegister;
+
+#define VECTOR_SHUFFLE_MASK(X, Y, Z, W) ((X) | ((Y) << 2) | ((Z) << 4) | ((W) << 6))
+
+// ------------------------------------------------------------
+// 로드 / 저장
+// ------------------------------------------------------------
+
+inline VectorRegister VectorZero()
+{
+    return _mm_setzero_ps();
+}
+
+inline VectorRegister VectorSet(float X, float Y, float Z, float W)
+{
+    return _mm_setr_ps(X, Y, Z, W);
+}
+
+inline VectorRegister VectorSetFloat1(float Value)
+{
+    return _mm_set1_ps(Value);
+}
+
+// 정렬되지 않은 float 4개
+inline VectorRegister VectorLoad(const float* Ptr)
+{
+    return _mm_loadu_ps(Ptr);
+}
+
+// 한 개의 float를 네 성분에 복제
+inline VectorRegister VectorLoadFloat1(const float* Ptr)
+{
+    return _mm_load1_ps(Ptr);
+}
+
+// float 3개만 읽는다 (FVector 배열 끝을 넘어 읽지 않음), W = 0
+inline VectorRegister VectorLoadFloat3(const float* Ptr)
+{
+    const VectorRegister XY = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(Ptr));
+    return _mm_movelh_ps(XY, _mm_load_ss(Ptr + 2));
+}
+
+inline void VectorStore(const VectorRegister& Vec, float* Ptr)
+{
+    _mm_storeu_ps(Ptr, Vec);
+}
+
+// X, Y, Z만 쓴다
+inline void VectorStoreFloat3(const VectorRegister& Vec, float* Ptr)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(Ptr), Vec);
+    _mm_store_ss(Ptr + 2, _mm_movehl_ps(Vec, Vec));
+}
+
+template<int32 Index>
+inline VectorRegister VectorReplicate(const VectorRegister& Vec)
+{
+    return _mm_shuffle_ps(Vec, Vec, VECTOR_SHUFFLE_MASK(Index, Index, Index, Index));
+}
+
+template<int32 Index>
+inline float VectorGetComponent(const VectorRegister& Vec)
+{
+    return _mm_cvtss_f32(VectorReplicate<Index>(Vec));
+}
+
+// 결과 = (Vec[X], Vec[Y], Vec[Z], Vec[W])
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline VectorRegister VectorSwizzle(const VectorRegister& Vec)
+{
+    return _mm_shuffle_ps(Vec, Vec, VECTOR_SHUFFLE_MASK(X, Y, Z, W));
+}
+
+// ------------------------------------------------------------
+// 산술
+// ------------------------------------------------------------
+
+inline VectorRegister VectorAdd(const VectorRegister& A, const VectorRegister& B) { return _mm_add_ps(A, B); }
+inline VectorRegister VectorSubtract(const VectorRegister& A, const VectorRegister& B) { return _mm_sub_ps(A, B); }
+inline VectorRegister VectorMultiply(const VectorRegister& A, const VectorRegister& B) { return _mm_mul_ps(A, B); }
+inline VectorRegister VectorDivide(const VectorRegister& A, const VectorRegister& B) { return _mm_div_ps(A, B); }
+inline VectorRegister VectorMin(const VectorRegister& A, const VectorRegister& B) { return _mm_min_ps(A, B); }
+inline VectorRegister VectorMax(const VectorRegister& A, const VectorRegister& B) { return _mm_max_ps(A, B); }
+
+inline VectorRegister VectorAbs(const VectorRegister& Vec)
+{
+    // 부호 비트만 지운다
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec);
+}
+
+// A * B + C
+inline VectorRegister VectorMultiplyAdd(const VectorRegister& A, const VectorRegister& B, const VectorRegister& C)
+{
+#if PLATFORM_ENABLE_VECTORINTRINSICS_FMA
+    return _mm_fmadd_ps(A, B, C);
+#else
+    return _mm_add_ps(_mm_mul_ps(A, B), C);
+#endif
+}
+
+// 네 성분의 합을 모든 성분에 담는다
+inline VectorRegister VectorSumComponents(const VectorRegister& Vec)
+{
+    const VectorRegister Pairs = _mm_add_ps(Vec, _mm_shuffle_ps(Vec, Vec, VECTOR_SHUFFLE_MASK(2, 3, 0, 1)));
+    return _mm_add_ps(Pairs, _mm_shuffle_ps(Pairs, Pairs, VECTOR_SHUFFLE_MASK(1, 0, 3, 2)));
+}
+
+inline VectorRegister VectorDot4(const VectorRegister& A, const VectorRegister& B)
+{
+    return VectorSumComponents(_mm_mul_ps(A, B));
+}
+
+// ------------------------------------------------------------
+// 행렬 (행 우선 float[16])
+// ------------------------------------------------------------
+
+inline void VectorMatrixTranspose(float* Result, const float* Matrix)
+{
+    VectorRegister R0 = _mm_loadu_ps(Matrix + 0);
+    VectorRegister R1 = _mm_loadu_ps(Matrix + 4);
+    VectorRegister R2 = _mm_loadu_ps(Matrix + 8);
+    VectorRegister R3 = _mm_loadu_ps(Matrix + 12);
+    _MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+    _mm_storeu_ps(Result + 0, R0);
+    _mm_storeu_ps(Result + 4, R1);
+    _mm_storeu_ps(Result + 8, R2);
+    _mm_storeu_ps(Result + 12, R3);
+}
+
+// Result = A * B - Result가 A나 B와 같은 메모리여도 된다
+inline void VectorMatrixMultiply(float* Result, const float* A, const float* B)
+{
+    const VectorRegister B0 = _mm_loadu_ps(B + 0);
+    const VectorRegister B1 = _mm_loadu_ps(B + 4);
+    const VectorRegister B2 = _mm_loadu_ps(B + 8);
+    const VectorRegister B3 = _mm_loadu_ps(B + 12);
+
+    VectorRegister Rows[ 4 ];
+    for (int32 i = 0; i < 4; ++i)
+    {
+        // 결과의 i행 = sum_k A[i][k] * B의 k행
+        const VectorRegister Row = _mm_loadu_ps(A + i * 4);
+        VectorRegister Acc = _mm_mul_ps(VectorReplicate<0>(Row), B0);
+        Acc = VectorMultiplyAdd(VectorReplicate<1>(Row), B1, Acc);
+        Acc = VectorMultiplyAdd(VectorReplicate<2>(Row), B2, Acc);
+        Rows[ i ] = VectorMultiplyAdd(VectorReplicate<3>(Row), B3, Acc);
+    }
+
+    for (int32 i = 0; i < 4; ++i)
+    {
+        _mm_storeu_ps(Result + i * 4, Rows[ i ]);
+    }
+}
+
+namespace VectorMatrixInternal
+{
+    // 2x2 행렬을 (m00, m01, m10, m11) 순서로 담아 계산하는 보조 함수들
+    inline VectorRegister Mat2Mul(const VectorRegister& A, const VectorRegister& B)
+    {
+        return _mm_add_ps(
+            _mm_mul_ps(A, _mm_shuffle_ps(B, B, VECTOR_SHUFFLE_MASK(0, 3, 0, 3))),
+            _mm_mul_ps(_mm_shuffle_ps(A, A, VECTOR_SHUFFLE_MASK(1, 0, 3, 2)), _mm_shuffle_ps(B, B, VECTOR_SHUFFLE_MASK(2, 1, 2, 1))));
+    }
+
+    // adj(A) * B
+    inline VectorRegister Mat2AdjMul(const VectorRegister& A, const VectorRegister& B)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(A, A, VECTOR_SHUFFLE_MASK(3, 3, 0, 0)), B),
+            _mm_mul_ps(_mm_shuffle_ps(A, A, VECTOR_SHUFFLE_MASK(1, 1, 2, 2)), _mm_shuffle_ps(B, B, VECTOR_SHUFFLE_MASK(2, 3, 0, 1))));
+    }
+
+    // A * adj(B)
+    inline VectorRegister Mat2MulAdj(const VectorRegister& A, const VectorRegister& B)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(A, _mm_shuffle_ps(B, B, VECTOR_SHUFFLE_MASK(3, 0, 3, 0))),
+            _mm_mul_ps(_mm_shuffle_ps(A, A, VECTOR_SHUFFLE_MASK(1, 0, 3, 2)), _mm_shuffle_ps(B, B, VECTOR_SHUFFLE_MASK(2, 1, 2, 1))));
+    }
+
+    // 4x4 행렬을 2x2 블록 A B / C D로 나눈 중간 결과
+    struct FBlockTerms
+    {
+        VectorRegister A, B, C, D;
+        VectorRegister DetA, DetB, DetC, DetD;
+        VectorRegister AdjAB, AdjDC;    // adj(A)*B, adj(D)*C
+        VectorRegister Det;             // 전체 행렬식 (네 성분 모두 같은 값)
+    };
+
+    inline FBlockTerms ComputeBlockTerms(const float* Matrix)
+    {
+        const VectorRegister R0 = _mm_loadu_ps(Matrix + 0);
+        const VectorRegister R1 = _mm_loadu_ps(Matrix + 4);
+        const VectorRegister R2 = _mm_loadu_ps(Matrix + 8);
+        const VectorRegister R3 = _mm_loadu_ps(Matrix + 12);
+
+        FBlockTerms Terms;
+        Terms.A = _mm_movelh_ps(R0, R1);
+        Terms.B = _mm_movehl_ps(R1, R0);
+        Terms.C = _mm_movelh_ps(R2, R3);
+        Terms.D = _mm_movehl_ps(R3, R2);
+
+        // 네 블록의 행렬식 (|A|, |B|, |C|, |D|)
+        const VectorRegister DetSub = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(R0, R2, VECTOR_SHUFFLE_MASK(0, 2, 0, 2)), _mm_shuffle_ps(R1, R3, VECTOR_SHUFFLE_MASK(1, 3, 1, 3))),
+            _mm_mul_ps(_mm_shuffle_ps(R0, R2, VECTOR_SHUFFLE_MASK(1, 3, 1, 3)), _mm_shuffle_ps(R1, R3, VECTOR_SHUFFLE_MASK(0, 2, 0, 2))));
+        Terms.DetA = VectorReplicate<0>(DetSub);
+        Terms.DetB = VectorReplicate<1>(DetSub);
+        Terms.DetC = VectorReplicate<2>(DetSub);
+        Terms.DetD = VectorReplicate<3>(DetSub);
+
+        Terms.AdjDC = Mat2AdjMul(Terms.D, Terms.C);
+        Terms.AdjAB = Mat2AdjMul(Terms.A, Terms.B);
+
+        // |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+        const VectorRegister Trace = VectorSumComponents(
+            _mm_mul_ps(Terms.AdjAB, _mm_shuffle_ps(Terms.AdjDC, Terms.AdjDC, VECTOR_SHUFFLE_MASK(0, 2, 1, 3))));
+        Terms.Det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(Terms.DetA, Terms.DetD), _mm_mul_ps(Terms.DetB, Terms.DetC)), Trace);
+        return Terms;
+    }
+}
+
+inline float VectorMatrixDeterminant(const float* Matrix)
+{
+    return _mm_cvtss_f32(VectorMatrixInternal::ComputeBlockTerms(Matrix).Det);
+}
+
+// 2x2 블록 분할로 역행렬을 구하고 행렬식을 돌려준다
+// 행렬식이 0에 가까운지는 호출자가 판단한다 (그 경우 Result는 무의미한 값)
+inline float VectorMatrixInverse(float* Result, const float* Matrix)
+{
+    using namespace VectorMatrixInternal;
+    const FBlockTerms T = ComputeBlockTerms(Matrix);
+
+    // 결과 = 1/|M| * [X Y; Z W]의 수반 행렬 블록
+    VectorRegister X = _mm_sub_ps(_mm_mul_ps(T.DetD, T.A), Mat2Mul(T.B, T.AdjDC));
+    VectorRegister W = _mm_sub_ps(_mm_mul_ps(T.DetA, T.D), Mat2Mul(T.C, T.AdjAB));
+    VectorRegister Y = _mm_sub_ps(_mm_mul_ps(T.DetB, T.C), Mat2MulAdj(T.D, T.AdjAB));
+    VectorRegister Z = _mm_sub_ps(_mm_mul_ps(T.DetC, T.B), Mat2MulAdj(T.A, T.AdjDC));
+
+    const VectorRegister RcpDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), T.Det);
+    X = _mm_mul_ps(X, RcpDet);
+    Y = _mm_mul_ps(Y, RcpDet);
+    Z = _mm_mul_ps(Z, RcpDet);
+    W = _mm_mul_ps(W, RcpDet);
+
+    // 수반 행렬 셔플과 블록 재배치를 한 번에
+    _mm_storeu_ps(Result + 0, _mm_shuffle_ps(X, Y, VECTOR_SHUFFLE_MASK(3, 1, 3, 1)));
+    _mm_storeu_ps(Result + 4, _mm_shuffle_ps(X, Y, VECTOR_SHUFFLE_MASK(2, 0, 2, 0)));
+    _mm_storeu_ps(Result + 8, _mm_shuffle_ps(Z, W, VECTOR_SHUFFLE_MASK(3, 1, 3, 1)));
+    _mm_storeu_ps(Result + 12, _mm_shuffle_ps(Z, W, VECTOR_SHUFFLE_MASK(2, 0, 2, 0)));
+
+    return _mm_cvtss_f32(T.Det);
+}
+
+#else // PLATFORM_ENABLE_VECTORINTRINSICS
+
+// SIMD가 없는 플랫폼용 스칼라 구현 - 인터페이스와 결과는 SSE 경로와 같다
+struct alignas(16) VectorRegister
+{
+    float V[ 4 ];
+};
+
+#define PLATFORM_ENABLE_VECTORINTRINSICS_FMA 0
+
+inline VectorRegister VectorZero()
+{
+    return VectorRegister{ { 0.0f, 0.0f, 0.0f, 0.0f } };
+}
+
+inline VectorRegister VectorSet(float X, float Y, float Z, float W)
+{
+    return VectorRegister{ { X, Y, Z, W } };
+}
+
+inline VectorRegister VectorSetFloat1(float Value)
+{
+    return VectorRegister{ { Value, Value, Value, Value } };
+}
+
+inline VectorRegister VectorLoad(const float* Ptr)
+{
+    return VectorRegister{ { Ptr[ 0 ], Ptr[ 1 ], Ptr[ 2 ], Ptr[ 3 ] } };
+}
+
+inline VectorRegister VectorLoadFloat1(const float* Ptr)
+{
+    return VectorSetFloat1(*Ptr);
+}
+
+inline VectorRegister VectorLoadFloat3(const float* Ptr)
+{
+    return VectorRegister{ { Ptr[ 0 ], Ptr[ 1 ], Ptr[ 2 ], 0.0f } };
+}
+
+inline void VectorStore(const VectorRegister& Vec, float* Ptr)
+{
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Ptr[ i ] = Vec.V[ i ];
+    }
+}
+
+inline void VectorStoreFloat3(const VectorRegister& Vec, float* Ptr)
+{
+    Ptr[ 0 ] = Vec.V[ 0 ];
+    Ptr[ 1 ] = Vec.V[ 1 ];
+    Ptr[ 2 ] = Vec.V[ 2 ];
+}
+
+template<int32 Index>
+inline VectorRegister VectorReplicate(const VectorRegister& Vec)
+{
+    return VectorSetFloat1(Vec.V[ Index ]);
+}
+
+template<int32 Index>
+inline float VectorGetComponent(const VectorRegister& Vec)
+{
+    return Vec.V[ Index ];
+}
+
+template<int32 X, int32 Y, int32 Z, int32 W>
+inline VectorRegister VectorSwizzle(const VectorRegister& Vec)
+{
+    return VectorRegister{ { Vec.V[ X ], Vec.V[ Y ], Vec.V[ Z ], Vec.V[ W ] } };
+}
+
+#define VECTOR_SCALAR_BINARY_OP(Name, Expr) \
+    inline VectorRegister Name(const VectorRegister& A, const VectorRegister& B) \
+    { \
+        VectorRegister Result; \
+        for (int32 i = 0; i < 4; ++i) \
+        { \
+            const float L = A.V[ i ]; \
+            const float R = B.V[ i ]; \
+            Result.V[ i ] = (Expr); \
+        } \
+        return Result; \
+    }
+
+VECTOR_SCALAR_BINARY_OP(VectorAdd, L + R)
+VECTOR_SCALAR_BINARY_OP(VectorSubtract, L - R)
+VECTOR_SCALAR_BINARY_OP(VectorMultiply, L * R)
+VECTOR_SCALAR_BINARY_OP(VectorDivide, L / R)
+VECTOR_SCALAR_BINARY_OP(VectorMin, L < R ? L : R)
+VECTOR_SCALAR_BINARY_OP(VectorMax, L > R ? L : R)
+
+#undef VECTOR_SCALAR_BINARY_OP
+
+inline VectorRegister VectorAbs(const VectorRegister& Vec)
+{
+    return VectorRegister{ { std::fabs(Vec.V[ 0 ]), std::fabs(Vec.V[ 1 ]), std::fabs(Vec.V[ 2 ]), std::fabs(Vec.V[ 3 ]) } };
+}
+
+inline VectorRegister VectorMultiplyAdd(const VectorRegister& A, const VectorRegister& B, const VectorRegister& C)
+{
+    return VectorAdd(VectorMultiply(A, B), C);
+}
+
+inline VectorRegister VectorSumComponents(const VectorRegister& Vec)
+{
+    return VectorSetFloat1(Vec.V[ 0 ] + Vec.V[ 1 ] + Vec.V[ 2 ] + Vec.V[ 3 ]);
+}
+
+inline VectorRegister VectorDot4(const VectorRegister& A, const VectorRegister& B)
+{
+    return VectorSumComponents(VectorMultiply(A, B));
+}
+
+inline void VectorMatrixTranspose(float* Result, const float* Matrix)
+{
+    if (Result != Matrix)
+    {
+        for (int32 i = 0; i < 16; ++i)
+        {
+            Result[ i ] = Matrix[ i ];
+        }
+    }
+
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = Row + 1; Col < 4; ++Col)
+        {
+            const float Temp = Result[ Row * 4 + Col ];
+            Result[ Row * 4 + Col ] = Result[ Col * 4 + Row ];
+            Result[ Col * 4 + Row ] = Temp;
+        }
+    }
+}
+
+inline void VectorMatrixMultiply(float* Result, const float* A, const float* B)
+{
+    float Temp[ 16 ];
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 4; ++Col)
+        {
+            Temp[ Row * 4 + Col ] =
+                A[ Row * 4 + 0 ] * B[ 0 * 4 + Col ] +
+                A[ Row * 4 + 1 ] * B[ 1 * 4 + Col ] +
+                A[ Row * 4 + 2 ] * B[ 2 * 4 + Col ] +
+                A[ Row * 4 + 3 ] * B[ 3 * 4 + Col ];
+        }
+    }
+    for (int32 i = 0; i < 16; ++i)
+    {
+        Result[ i ] = Temp[ i ];
+    }
+}
+
+namespace VectorMatrixInternal
+{
+    // 아래 두 행의 2x2 소행렬식 6개 (여인수 전개에 공통으로 쓰인다)
+    struct FCofactorTerms
+    {
+        float S[ 6 ];   // 위 두 행
+        float C[ 6 ];   // 아래 두 행
+    };
+
+    inline FCofactorTerms ComputeCofactorTerms(const float* M)
+    {
+        FCofactorTerms T;
+        T.S[ 0 ] = M[ 0 ] * M[ 5 ] - M[ 4 ] * M[ 1 ];
+        T.S[ 1 ] = M[ 0 ] * M[ 6 ] - M[ 4 ] * M[ 2 ];
+        T.S[ 2 ] = M[ 0 ] * M[ 7 ] - M[ 4 ] * M[ 3 ];
+        T.S[ 3 ] = M[ 1 ] * M[ 6 ] - M[ 5 ] * M[ 2 ];
+        T.S[ 4 ] = M[ 1 ] * M[ 7 ] - M[ 5 ] * M[ 3 ];
+        T.S[ 5 ] = M[ 2 ] * M[ 7 ] - M[ 6 ] * M[ 3 ];
+
+        T.C[ 5 ] = M[ 10 ] * M[ 15 ] - M[ 14 ] * M[ 11 ];
+        T.C[ 4 ] = M[ 9 ] * M[ 15 ] - M[ 13 ] * M[ 11 ];
+        T.C[ 3 ] = M[ 9 ] * M[ 14 ] - M[ 13 ] * M[ 10 ];
+        T.C[ 2 ] = M[ 8 ] * M[ 15 ] - M[ 12 ] * M[ 11 ];
+        T.C[ 1 ] = M[ 8 ] * M[ 14 ] - M[ 12 ] * M[ 10 ];
+        T.C[ 0 ] = M[ 8 ] * M[ 13 ] - M[ 12 ] * M[ 9 ];
+        return T;
+    }
+
+    inline float DeterminantFromTerms(const FCofactorTerms& T)
+    {
+        return T.S[ 0 ] * T.C[ 5 ] - T.S[ 1 ] * T.C[ 4 ] + T.S[ 2 ] * T.C[ 3 ]
+             + T.S[ 3 ] * T.C[ 2 ] - T.S[ 4 ] * T.C[ 1 ] + T.S[ 5 ] * T.C[ 0 ];
+    }
+}
+
+inline float VectorMatrixDeterminant(const float* Matrix)
+{
+    return VectorMatrixInternal::DeterminantFromTerms(VectorMatrixInternal::ComputeCofactorTerms(Matrix));
+}
+
+inline float VectorMatrixInverse(float* Result, const float* M)
+{
+    using namespace VectorMatrixInternal;
+    const FCofactorTerms T = ComputeCofactorTerms(M);
+    const float Det = DeterminantFromTerms(T);
+    const float InvDet = 1.0f / Det;
+    const float* S = T.S;
+    const float* C = T.C;
+
+    float Inv[ 16 ];
+    Inv[ 0 ] = ( M[ 5 ] * C[ 5 ] - M[ 6 ] * C[ 4 ] + M[ 7 ] * C[ 3 ]) * InvDet;
+    Inv[ 1 ] = (-M[ 1 ] * C[ 5 ] + M[ 2 ] * C[ 4 ] - M[ 3 ] * C[ 3 ]) * InvDet;
+    Inv[ 2 ] = ( M[ 13 ] * S[ 5 ] - M[ 14 ] * S[ 4 ] + M[ 15 ] * S[ 3 ]) * InvDet;
+    Inv[ 3 ] = (-M[ 9 ] * S[ 5 ] + M[ 10 ] * S[ 4 ] - M[ 11 ] * S[ 3 ]) * InvDet;
+
+    Inv[ 4 ] = (-M[ 4 ] * C[ 5 ] + M[ 6 ] * C[ 2 ] - M[ 7 ] * C[ 1 ]) * InvDet;
+    Inv[ 5 ] = ( M[ 0 ] * C[ 5 ] - M[ 2 ] * C[ 2 ] + M[ 3 ] * C[ 1 ]) * InvDet;
+    Inv[ 6 ] = (-M[ 12 ] * S[ 5 ] + M[ 14 ] * S[ 2 ] - M[ 15 ] * S[ 1 ]) * InvDet;
+    Inv[ 7 ] = ( M[ 8 ] * S[ 5 ] - M[ 10 ] * S[ 2 ] + M[ 11 ] * S[ 1 ]) * InvDet;
+
+    Inv[ 8 ] = ( M[ 4 ] * C[ 4 ] - M[ 5 ] * C[ 2 ] + M[ 7 ] * C[ 0 ]) * InvDet;
+    Inv[ 9 ] = (-M[ 0 ] * C[ 4 ] + M[ 1 ] * C[ 2 ] - M[ 3 ] * C[ 0 ]) * InvDet;
+    Inv[ 10 ] = ( M[ 12 ] * S[ 4 ] - M[ 13 ] * S[ 2 ] + M[ 15 ] * S[ 0 ]) * InvDet;
+    Inv[ 11 ] = (-M[ 8 ] * S[ 4 ] + M[ 9 ] * S[ 2 ] - M[ 11 ] * S[ 0 ]) * InvDet;
+
+    Inv[ 12 ] = (-M[ 4 ] * C[ 3 ] + M[ 5 ] * C[ 1 ] - M[ 6 ] * C[ 0 ]) * InvDet;
+    Inv[ 13 ] = ( M[ 0 ] * C[ 3 ] - M[ 1 ] * C[ 1 ] + M[ 2 ] * C[ 0 ]) * InvDet;
+    Inv[ 14 ] = (-M[ 12 ] * S[ 3 ] + M[ 13 ] * S[ 1 ] - M[ 14 ] * S[ 0 ]) * InvDet;
+    Inv[ 15 ] = ( M[ 8 ] * S[ 3 ] - M[ 9 ] * S[ 1 ] + M[ 10 ] * S[ 0 ]) * InvDet;
+
+    for (int32 i = 0; i < 16; ++i)
+    {
+        Result[ i ] = Inv[ i ];
+    }
+    return Det;
+}
+
+#endif // PLATFORM_ENABLE_VECTORINTRINSICS
+
+// ------------------------------------------------------------
+// 외적 / 쿼터니언 (공통 - 위의 기본 연산만으로 구성)
+// 쿼터니언은 (X, Y, Z, W) 순서이며 W가 스칼라 부분이다.
+// ------------------------------------------------------------
+
+// XYZ 외적, W = 0 (입력 W가 0일 때)
+inline VectorRegister VectorCross3(const VectorRegister& A, const VectorRegister& B)
+{
+    const VectorRegister AYZX = VectorSwizzle<1, 2, 0, 3>(A);
+    const VectorRegister BYZX = VectorSwizzle<1, 2, 0, 3>(B);
+    const VectorRegister Cross = VectorSubtract(VectorMultiply(A, BYZX), VectorMultiply(AYZX, B));
+    return VectorSwizzle<1, 2, 0, 3>(Cross);
+}
+
+// 해밀턴 곱 A * B - 회전으로는 B를 먼저 적용한 뒤 A를 적용한다
+inline VectorRegister VectorQuaternionMultiply(const VectorRegister& A, const VectorRegister& B)
+{
+    VectorRegister Result = VectorMultiply(VectorReplicate<3>(A), B);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate<0>(A), VectorSwizzle<3, 2, 1, 0>(B)), VectorSet(1.0f, -1.0f, 1.0f, -1.0f), Result);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate<1>(A), VectorSwizzle<2, 3, 0, 1>(B)), VectorSet(1.0f, 1.0f, -1.0f, -1.0f), Result);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate<2>(A), VectorSwizzle<1, 0, 3, 2>(B)), VectorSet(-1.0f, 1.0f, 1.0f, -1.0f), Result);
+    return Result;
+}
+
+// 켤레 (단위 쿼터니언이면 역회전)
+inline VectorRegister VectorQuaternionConjugate(const VectorRegister& Quat)
+{
+    return VectorMultiply(Quat, VectorSet(-1.0f, -1.0f, -1.0f, 1.0f));
+}
+
+// 단위 쿼터니언으로 벡터(W = 0)를 회전한다
+// V' = V + W * T + Q x T, T = 2 * (Q x V)
+inline VectorRegister VectorQuaternionRotateVector(const VectorRegister& Quat, const VectorRegister& Vec)
+{
+    const VectorRegister QuatXYZ = VectorMultiply(Quat, VectorSet(1.0f, 1.0f, 1.0f, 0.0f));
+    const VectorRegister Cross = VectorCross3(QuatXYZ, Vec);
+    const VectorRegister T = VectorAdd(Cross, Cross);
+    const VectorRegister Result = VectorMultiplyAdd(VectorReplicate<3>(Quat), T, Vec);
+    return VectorAdd(Result, VectorCross3(QuatXYZ, T));
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include "Types.h"
+#include "Object.h"
+#include "UObjectArray.h"
+#include <functional>
+
+// GUObjectArray 인덱스 + 슬롯 시리얼 번호로 오브젝트를 가리키는 약한 참조 (8바이트, 할당 없음)
+// 슬롯이 해제될 때마다 시리얼 번호가 증가하므로, 해제된 뒤 같은 슬롯이 재사용되어도
+// 이전 참조는 새 오브젝트가 아니라 nullptr로 해석된다.
+struct FWeakObjectPtr
+{
+public:
+    FWeakObjectPtr()
+        : ObjectIndex(-1)
+        , ObjectSerialNumber(0)
+    {
+    }
+
+    FWeakObjectPtr(std::nullptr_t)
+        : FWeakObjectPtr()
+    {
+    }
+
+    FWeakObjectPtr(const UObject* Object)
+        : FWeakObjectPtr()
+    {
+        *this = Object;
+    }
+
+    FWeakObjectPtr& operator=(const UObject* Object)
+    {
+        const FUObjectItem* Item = Object ? GUObjectArray.GetObjectItemPtr(Object->GetInternalIndex()) : nullptr;
+        if (Item && Item->Object == Object)
+        {
+            ObjectIndex = Object->GetInternalIndex();
+            ObjectSerialNumber = Item->SerialNumber;
+        }
+        else
+        {
+            Reset();
+        }
+        return *this;
+    }
+
+    void Reset()
+    {
+        ObjectIndex = -1;
+        ObjectSerialNumber = 0;
+    }
+
+    // 가리키던 오브젝트가 해제되었으면 nullptr, PendingKill이면 bEvenIfPendingKill일 때만 반환
+    UObject* Get(bool bEvenIfPendingKill = false) const
+    {
+        const FUObjectItem* Item = GetObjectItem();
+        if (!Item || (!bEvenIfPendingKill && Item->Object->IsPendingKill()))
+        {
+            return nullptr;
+        }
+        return Item->Object;
+    }
+
+    bool IsValid(bool bEvenIfPendingKill = false) const { return Get(bEvenIfPendingKill) != nullptr; }
+
+    // 한 번이라도 오브젝트를 가리켰지만 그 오브젝트가 이제 해제된 경우
+    bool IsStale() const { return ObjectIndex >= 0 && !GetObjectItem(); }
+
+    // 아무것도 가리킨 적이 없는 경우
+    bool IsExplicitlyNull() const { return ObjectIndex < 0; }
+
+    bool operator==(const FWeakObjectPtr& Other) const
+    {
+        return ObjectIndex == Other.ObjectIndex && ObjectSerialNumber == Other.ObjectSerialNumber;
+    }
+
+    bool operator!=(const FWeakObjectPtr& Other) const { return !(*this == Other); }
+
+    size_t GetTypeHash() const
+    {
+        return (static_cast<uint64>(static_cast<uint32>(ObjectSerialNumber)) << 32) | static_cast<uint32>(ObjectIndex);
+    }
+
+private:
+    int32 ObjectIndex;
+    int32 ObjectSerialNumber;
+
+    const FUObjectItem* GetObjectItem() const
+    {
+        const FUObjectItem* Item = GUObjectArray.GetObjectItemPtr(ObjectIndex);
+        return (Item && Item->SerialNumber == ObjectSerialNumber && Item->IsValid()) ? Item : nullptr;
+    }
+};
+
+static_assert(sizeof(FWeakObjectPtr) == 8, "FWeakObjectPtr must stay 8 bytes");
+
+// 타입이 있는 약한 참조 - 소유하지 않는 참조(델리게이트 바인딩, UI가 보고 있는 레벨 등)에 사용
+// GC는 약한 참조를 따라가지 않으므로 오브젝트의 수명에 영향을 주지 않는다.
+template<typename T>
+class TWeakObjectPtr
+{
+public:
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+
+    TWeakObjectPtr(const T* Object)
+        : WeakPtr(static_cast<const UObject*>(Object))
+    {
+    }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    TWeakObjectPtr(const TWeakObjectPtr<U>& Other)
+        : WeakPtr(Other.WeakPtr)
+    {
+    }
+
+    TWeakObjectPtr& operator=(const T* Object)
+    {
+        WeakPtr = static_cast<const UObject*>(Object);
+        return *this;
+    }
+
+    TWeakObjectPtr& operator=(std::nullptr_t)
+    {
+        WeakPtr.Reset();
+        return *this;
+    }
+
+    void Reset() { WeakPtr.Reset(); }
+
+    T* Get(bool bEvenIfPendingKill = false) const { return static_cast<T*>(WeakPtr.Get(bEvenIfPendingKill)); }
+
+    bool IsValid(bool bEvenIfPendingKill = false) const { return WeakPtr.IsValid(bEvenIfPendingKill); }
+    bool IsStale() const { return WeakPtr.IsStale(); }
+    bool IsExplicitlyNull() const { return WeakPtr.IsExplicitlyNull(); }
+
+    T* operator->() const { return Get(); }
+    T& operator*() const { return *Get(); }
+    explicit operator bool() const { return IsValid(); }
+
+    bool operator==(const TWeakObjectPtr& Other) const { return WeakPtr == Other.WeakPtr; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return WeakPtr != Other.WeakPtr; }
+
+    size_t GetTypeHash() const { return WeakPtr.GetTypeHash(); }
+
+private:
+    template<typename U>
+    friend class TWeakObjectPtr;
+
+    FWeakObjectPtr WeakPtr;
+};
+
+// 해시 함수 특수화 (std::unordered_map 등에서 사용)
+namespace std
+{
+    template<>
+    struct hash<FWeakObjectPtr>
+    {
+        size_t operator()(const FWeakObjectPtr& Ptr) const
+        {
+            return Ptr.GetTypeHash();
+        }
+    };
+
+    template<typename T>
+    struct hash<TWeakObjectPtr<T>>
+    {
+        size_t operator()(const TWeakObjectPtr<T>& Ptr) const
+        {
+            return Ptr.GetTypeHash();
+        }
+    };
+}
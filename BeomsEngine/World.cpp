@@ -1,8 +1,10 @@
 #include "pch.h"
 #include "World.h"
 #include "Actor.h"
+#include "SceneComponent.h"
 #include "StaticMeshActor.h"
 #include "ObjectInitializer.h"
+#include "Delegate.h"
 
 IMPLEMENT_CLASS(UWorld, UObject)
 
@@ -19,6 +21,8 @@ UWorld::UWorld()
     , RealTimeSeconds(0.0f)
     , DeltaTimeSeconds(0.0f)
 {
+    // 월드는 GC 루트 - DestroyWorld로 PendingKill이 되면 루트에서 제외된다
+    AddToRoot();
 }
 
 UWorld::~UWorld()
@@ -32,6 +36,20 @@ UWorld::~UWorld()
     }
 }
 
+void UWorld::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    Super::AddReferencedObjects(Collector);
+
+    Collector.AddReferencedObject(CurrentLevel);
+}
+
+void UWorld::BeginDestroy()
+{
+    CleanupWorld();
+
+    Super::BeginDestroy();
+}
+
 void UWorld::BeginPlay()
 {
     if (!bIsInitialized)
@@ -61,19 +79,29 @@ void UWorld::EndPlay()
 
 void UWorld::Tick(float DeltaTime)
 {
-    if (!bIsPlaying || bIsPaused)
+    // 이전 프레임의 임시 할당 정리
+    FMemStack::Get().Flush();
+
+    if (bIsPlaying && !bIsPaused)
     {
-        return;
+        // 시간 관리 업데이트
+        AddDeltaTime(DeltaTime);
+
+        // 현재 레벨 업데이트
+        if (CurrentLevel && CurrentLevel->IsLoaded())
+        {
+            CurrentLevel->Tick(DeltaTime);
+        }
     }
 
-    // 시간 관리 업데이트
-    AddDeltaTime(DeltaTime);
+    // 이번 프레임에 큐잉된 델리게이트 브로드캐스트를 한 번에 호출 - 에디터 편집은 플레이 중이 아니어도 큐잉된다
+    FDelegateBroadcastQueue::Get().Dispatch();
 
-    // 현재 레벨 업데이트
-    if (CurrentLevel && CurrentLevel->IsLoaded())
-    {
-        CurrentLevel->Tick(DeltaTime);
-    }
+    // 이번 프레임에 미뤄 둔 World Transform 갱신을 렌더링 전에 한 번에 처리
+    USceneComponent::FlushTransformUpdates();
+
+    // 예산 안에서 GC 진행 - 일시정지 중에도 진행하며, 이 월드도 수집될 수 있으므로 마지막에 호출
+    GUObjectArray.TickGarbageCollection(DeltaTime);
 }
 
 void UWorld::SetCurrentLevel(ULevel* Level)
@@ -86,6 +114,7 @@ void UWorld::SetCurrentLevel(ULevel* Level)
     }
 
     CurrentLevel = Level;
+    ReferenceWriteBarrier(CurrentLevel);
 
     if (CurrentLevel)
     {
@@ -131,13 +160,15 @@ AActor* UWorld::FindActor(const FName& ActorName) const
     return nullptr;
 }
 
-TArray<AActor*> UWorld::GetAllActors() const
+const TArray<TObjectPtr<AActor>>& UWorld::GetAllActors() const
 {
     if (CurrentLevel)
     {
         return CurrentLevel->GetActors();
     }
-    return TArray<AActor*>();
+
+    static const TArray<TObjectPtr<AActor>> EmptyActors;
+    return EmptyActors;
 }
 
 int32 UWorld::GetTotalActorCount() const
@@ -20,6 +20,10 @@ public:
     // UObject 오버라이드
     virtual FString GetClassName() const override { return "UWorld"; }
 
+    // GC
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual void BeginDestroy() override;
+
     // 월드 관리
     virtual void BeginPlay();
     virtual void EndPlay();
@@ -50,7 +54,11 @@ public:
     template<typename T>
     TArray<T*> GetActorsOfClass() const;
 
-    TArray<AActor*> GetAllActors() const;
+    template<typename T, typename AllocatorType>
+    void GetActorsOfClass(TArray<T*, AllocatorType>& OutActors) const;
+
+    // 현재 레벨의 액터 배열을 복사 없이 반환
+    const TArray<TObjectPtr<AActor>>& GetAllActors() const;
     int32 GetTotalActorCount() const;
 
     // 월드 설정
@@ -132,6 +140,16 @@ TArray<T*> UWorld::GetActorsOfClass() const
     return TArray<T*>();
 }
 
+template<typename T, typename AllocatorType>
+void UWorld::GetActorsOfClass(TArray<T*, AllocatorType>& OutActors) const
+{
+    OutActors.clear();
+    if (CurrentLevel)
+    {
+        CurrentLevel->GetActorsOfClass<T>(OutActors);
+    }
+}
+
 // 전역 월드 접근 함수
 UWorld* GetWorld();
 void SetGlobalWorld(UWorld* World);
\ No newline at end of file
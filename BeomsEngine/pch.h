@@ -40,6 +40,8 @@
 
 // === Core Types ===
 #include "Types.h"
+#include "Memory.h"
+#include "MemStack.h"
 #include "String.h"
 #include "Containers.h"
 #include "Name.h"
@@ -55,11 +57,15 @@
 #include "Class.h"
 #include "UObjectArray.h"
 #include "UObjectIterator.h"
+#include "WeakObjectPtr.h"
+#include "ObjectPtr.h"
 
 // === Math ===
 #include "Vector.h"
 #include "Vector2.h"
 #include "Matrix.h"
+#include "Quat.h"
+#include "Transform.h"
 
 // === Standard Library ===
 #include <unordered_map>